@@ -0,0 +1,93 @@
+/*
+  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization
+  dedicated to making software imaging solutions freely available.
+
+  You may not use this file except in compliance with the License.  You may
+  obtain a copy of the License at
+
+    https://imagemagick.org/script/license.php
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  Imports the FFTW wisdom that is installed with the configuration files.
+  The build creates the file with the fftw-wisdom tool and the tool can be
+  run again on the production hardware.  The Fourier transforms of MagickCore
+  must call MagickImportFFTWWisdom before they create a plan, so the delegate
+  is only used when a transform is requested and never from DllMain.  The
+  wisdom is created for plans with one thread and FFTW does not use it for
+  plans with more threads.
+*/
+#include "MagickCore/studio.h"
+
+#if defined(MAGICKCORE_FFTW_DELEGATE) && defined(MAGICKCORE_FFTW_WISDOM) && \
+    defined(_WIN32)
+#include "MagickCore/log.h"
+#include "fftw3.h"
+#include "fftw-wisdom.h"
+
+static INIT_ONCE
+  wisdom_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK ImportWisdom(PINIT_ONCE once,PVOID parameter,
+  PVOID *context)
+{
+  char
+    path[MAX_PATH];
+
+  DWORD
+    attributes;
+
+  HMODULE
+    module;
+
+  size_t
+    length;
+
+  char
+    *p;
+
+  (void) once;
+  (void) parameter;
+  (void) context;
+  if (GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+      GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+      (LPCSTR) MagickImportFFTWWisdom,&module) == 0)
+    return(TRUE);
+  length=(size_t) GetModuleFileNameA(module,path,MAX_PATH);
+  if ((length == 0) || (length >= MAX_PATH))
+    return(TRUE);
+  p=strrchr(path,'\\');
+  if (p == (char *) NULL)
+    return(TRUE);
+  *(p+1)='\0';
+  if (strlen(path)+strlen(MAGICKCORE_FFTW_WISDOM) >= MAX_PATH)
+    return(TRUE);
+  (void) strcat(path,MAGICKCORE_FFTW_WISDOM);
+  /*
+    The plans are estimated as before when the wisdom was not installed.
+  */
+  attributes=GetFileAttributesA(path);
+  if ((attributes == INVALID_FILE_ATTRIBUTES) ||
+      ((attributes & FILE_ATTRIBUTE_DIRECTORY) != 0))
+    return(TRUE);
+  (void) LogMagickEvent(ConfigureEvent,GetMagickModule(),
+    "Loading FFTW wisdom file \"%s\" ...",path);
+  if (fftw_import_wisdom_from_filename(path) == 0)
+    (void) LogMagickEvent(ConfigureEvent,GetMagickModule(),
+      "Unable to import the FFTW wisdom file \"%s\"",path);
+  return(TRUE);
+}
+
+/*
+  Imports the wisdom once, the other threads wait until it is imported
+  because the planner of FFTW is not thread safe.
+*/
+void MagickImportFFTWWisdom(void)
+{
+  (void) InitOnceExecuteOnce(&wisdom_once,ImportWisdom,NULL,NULL);
+}
+#endif
@@ -0,0 +1,109 @@
+/*
+  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization
+  dedicated to making software imaging solutions freely available.
+
+  You may not use this file except in compliance with the License.  You may
+  obtain a copy of the License at
+
+    https://imagemagick.org/script/license.php
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  Checks that the processor supports the instruction set level that
+  VisualMagick configure built MagickCore for with the targetIsa option, and
+  reports the problem and exits when it does not, instead of failing later
+  with an illegal instruction.  This file is compiled with the baseline
+  instruction set so the check itself runs on every processor.
+*/
+#include "MagickCore/magick-baseconfig.h"
+
+#if defined(MAGICKCORE_HAVE_SSE4_2) && defined(_MSC_VER) && \
+    (defined(_M_X64) || defined(_M_IX86))
+#include <windows.h>
+#include <intrin.h>
+#include <stdio.h>
+
+static int IsTargetIsaSupported(void)
+{
+  int
+    info[4];
+
+  unsigned int
+    extended;
+
+  __cpuid(info,0);
+  if (info[0] < 7)
+    return(0);
+  __cpuid(info,0x80000000);
+  if ((unsigned int) info[0] < 0x80000001)
+    return(0);
+  __cpuid(info,0x80000001);
+  extended=(unsigned int) info[2];
+  __cpuid(info,1);
+  /*
+    SSE3, SSSE3, CMPXCHG16B, SSE4.1, SSE4.2, POPCNT and LAHF/SAHF.
+  */
+  if ((((unsigned int) info[2] & 0x00982201) != 0x00982201) ||
+      ((extended & 0x00000001) == 0))
+    return(0);
+#if defined(MAGICKCORE_HAVE_AVX2)
+  /*
+    FMA, MOVBE, OSXSAVE, AVX, F16C and LZCNT.
+  */
+  if ((((unsigned int) info[2] & 0x38401000) != 0x38401000) ||
+      ((extended & 0x00000020) == 0))
+    return(0);
+  /*
+    The operating system saves the XMM and YMM registers.
+  */
+  if ((_xgetbv(0) & 0x06) != 0x06)
+    return(0);
+  __cpuidex(info,7,0);
+  /*
+    BMI1, AVX2 and BMI2.
+  */
+  if (((unsigned int) info[1] & 0x00000128) != 0x00000128)
+    return(0);
+#endif
+#if defined(MAGICKCORE_HAVE_AVX512)
+  /*
+    The operating system saves the opmask and ZMM registers.
+  */
+  if ((_xgetbv(0) & 0xe6) != 0xe6)
+    return(0);
+  /*
+    AVX512F, AVX512DQ, AVX512CD, AVX512BW and AVX512VL.
+  */
+  if (((unsigned int) info[1] & 0xd0030000) != 0xd0030000)
+    return(0);
+#endif
+  return(1);
+}
+
+static void CheckTargetIsa(void)
+{
+  const char
+    *message;
+
+  if (IsTargetIsaSupported() != 0)
+    return;
+  message="ImageMagick was built for the " MAGICKCORE_TARGET_ISA
+    " instruction set level, which this processor does not support.";
+  (void) fprintf(stderr,"%s\n",message);
+  if (GetConsoleWindow() == (HWND) NULL)
+    (void) MessageBoxA((HWND) NULL,message,"ImageMagick",MB_OK | MB_ICONERROR);
+  ExitProcess(1);
+}
+
+/*
+  Runs when the C runtime initializes the library, before any code that is
+  compiled for the instruction set level.
+*/
+#pragma section(".CRT$XCU",read)
+__declspec(allocate(".CRT$XCU")) static void
+  (*CheckTargetIsaInitializer)(void) = CheckTargetIsa;
+#endif
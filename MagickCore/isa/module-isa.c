@@ -0,0 +1,118 @@
+/*
+  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization
+  dedicated to making software imaging solutions freely available.
+
+  You may not use this file except in compliance with the License.  You may
+  obtain a copy of the License at
+
+    https://imagemagick.org/script/license.php
+
+  Unless required by applicable law or agreed to in writing, software
+  distributed under the License is distributed on an "AS IS" BASIS,
+  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  See the License for the specific language governing permissions and
+  limitations under the License.
+
+  Selects the directory of the coder and filter modules that are built for
+  the instruction set of the processor.  VisualMagick configure builds the
+  modules a second time with AVX2 code generation when the avx2Modules
+  option is used and this file points the module loader at them.  This file
+  is compiled without any /arch option so it runs on every processor.
+*/
+#include "MagickCore/magick-baseconfig.h"
+
+#if defined(MAGICKCORE_MODULES_AVX2_DIRECTORY) && defined(_MSC_VER) && \
+    (defined(_M_X64) || defined(_M_IX86))
+#include <windows.h>
+#include <intrin.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int IsAVX2Supported(void)
+{
+  int
+    info[4];
+
+  __cpuid(info,0);
+  if (info[0] < 7)
+    return(0);
+  __cpuid(info,1);
+  /*
+    FMA, OSXSAVE and AVX.
+  */
+  if ((info[2] & 0x18001000) != 0x18001000)
+    return(0);
+  /*
+    The operating system saves the XMM and YMM registers.
+  */
+  if ((_xgetbv(0) & 0x06) != 0x06)
+    return(0);
+  __cpuidex(info,7,0);
+  /*
+    BMI1, AVX2 and BMI2.
+  */
+  return((info[1] & 0x00000128) == 0x00000128 ? 1 : 0);
+}
+
+static void SelectModulePath(const char *variable,const char *directory)
+{
+  char
+    path[MAX_PATH];
+
+  DWORD
+    attributes;
+
+  HMODULE
+    module;
+
+  size_t
+    length;
+
+  char
+    *p;
+
+  if (getenv(variable) != (char *) NULL)
+    return;
+  if (GetModuleHandleExA(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+      GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,(LPCSTR) SelectModulePath,
+      &module) == 0)
+    return;
+  length=(size_t) GetModuleFileNameA(module,path,MAX_PATH);
+  if ((length == 0) || (length >= MAX_PATH))
+    return;
+  p=strrchr(path,'\\');
+  if (p == (char *) NULL)
+    return;
+  *(p+1)='\0';
+  if (strlen(path)+strlen(MAGICKCORE_MODULES_AVX2_DIRECTORY)+
+      strlen(directory)+2 >= MAX_PATH)
+    return;
+  (void) strcat(path,MAGICKCORE_MODULES_AVX2_DIRECTORY);
+  (void) strcat(path,"\\");
+  (void) strcat(path,directory);
+  /*
+    Only use the directory when the AVX2 modules were installed.
+  */
+  attributes=GetFileAttributesA(path);
+  if ((attributes == INVALID_FILE_ATTRIBUTES) ||
+      ((attributes & FILE_ATTRIBUTE_DIRECTORY) == 0))
+    return;
+  (void) _putenv_s(variable,path);
+}
+
+static void SelectModuleDirectories(void)
+{
+  if (IsAVX2Supported() == 0)
+    return;
+  SelectModulePath("MAGICK_CODER_MODULE_PATH","coders");
+  SelectModulePath("MAGICK_CODER_FILTER_PATH","filters");
+}
+
+/*
+  Runs when the C runtime initializes the library, before any module is
+  loaded.
+*/
+#pragma section(".CRT$XCU",read)
+__declspec(allocate(".CRT$XCU")) static void
+  (*SelectModuleDirectoriesInitializer)(void) = SelectModuleDirectories;
+#endif
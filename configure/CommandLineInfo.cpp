@@ -1,188 +1,324 @@
-/*
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-%                                                                             %
-%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
-%  dedicated to making software imaging solutions freely available.           %
-%                                                                             %
-%  You may not use this file except in compliance with the License.  You may  %
-%  obtain a copy of the License at                                            %
-%                                                                             %
-%    http://www.imagemagick.org/script/license.php                            %
-%                                                                             %
-%  Unless required by applicable law or agreed to in writing, software        %
-%  distributed under the License is distributed on an "AS IS" BASIS,          %
-%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
-%  See the License for the specific language governing permissions and        %
-%  limitations under the License.                                             %
-%                                                                             %
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-*/
-#include "stdafx.h"
-#include "CommandLineInfo.h"
-
-CommandLineInfo::CommandLineInfo(const ConfigureWizard &wizard)
-{
-  _platform=wizard.platform();
-  _enableDpc=wizard.enableDpc();
-  _excludeDeprecated=wizard.excludeDeprecated();
-  _includeIncompatibleLicense=wizard.includeIncompatibleLicense();
-  _includeOptional=wizard.includeOptional();
-  _installedSupport=wizard.installedSupport();
-  _noWizard=false;
-  _policyConfig=wizard.policyConfig();
-  _quantumDepth=wizard.quantumDepth();
-  _solutionType=wizard.solutionType();
-  _useHDRI=wizard.useHDRI();
-  _useOpenCL=true;
-  _useOpenMP=wizard.useOpenMP();
-  _visualStudioVersion=wizard.visualStudioVersion();
-  _zeroConfigurationSupport=wizard.zeroConfigurationSupport();
-}
-
-CommandLineInfo::CommandLineInfo(const CommandLineInfo& obj)
-{
-  *this = obj;
-}
-
-CommandLineInfo& CommandLineInfo::operator=(const CommandLineInfo& obj)
-{
-  return *this;
-}
-
-bool CommandLineInfo::enableDpc() const
-{
-  return(_enableDpc);
-}
-
-bool CommandLineInfo::excludeDeprecated() const
-{
-  return(_excludeDeprecated);
-}
-
-bool CommandLineInfo::includeIncompatibleLicense() const
-{
-  return(_includeIncompatibleLicense);
-}
-
-bool CommandLineInfo::includeOptional() const
-{
-  return(_includeOptional);
-}
-
-bool CommandLineInfo::installedSupport() const
-{
-  return(_installedSupport);
-}
-
-bool CommandLineInfo::noWizard() const
-{
-  return(_noWizard);
-}
-
-Platform CommandLineInfo::platform() const
-{
-  return(_platform);
-}
-
-PolicyConfig CommandLineInfo::policyConfig() const
-{
-  return(_policyConfig);
-}
-
-QuantumDepth CommandLineInfo::quantumDepth() const
-{
-  return(_quantumDepth);
-}
-
-SolutionType CommandLineInfo::solutionType() const
-{
-  return(_solutionType);
-}
-
-bool CommandLineInfo::useHDRI() const
-{
-  return(_useHDRI);
-}
-
-bool CommandLineInfo::useOpenCL() const
-{
-  return(_useOpenCL);
-}
-
-bool CommandLineInfo::useOpenMP() const
-{
-  return(_useOpenMP);
-}
-
-VisualStudioVersion CommandLineInfo::visualStudioVersion() const
-{
-  return(_visualStudioVersion);
-}
-
-bool CommandLineInfo::zeroConfigurationSupport() const
-{
-  return(_zeroConfigurationSupport);
-}
-
-void CommandLineInfo::ParseParam(const wchar_t* pszParam, BOOL bFlag, BOOL bLast)
-{
-  if (!bFlag)
-    return;
-
-  if (_wcsicmp(pszParam, L"arm64") == 0)
-    _platform=Platform::ARM64;
-  else if (_wcsicmp(pszParam, L"dmt") == 0)
-    _solutionType=SolutionType::DYNAMIC_MT;
-  else if (_wcsicmp(pszParam, L"deprecated") == 0)
-    _excludeDeprecated=FALSE;
-  else if (_wcsicmp(pszParam, L"smt") == 0)
-    _solutionType=SolutionType::STATIC_MT;
-  else if (_wcsicmp(pszParam, L"smtd") == 0)
-    _solutionType=SolutionType::STATIC_MTD;
-  else if (_wcsicmp(pszParam, L"hdri") == 0)
-    _useHDRI=true;
-  else if (_wcsicmp(pszParam, L"incompatibleLicense") == 0)
-     _includeIncompatibleLicense=true;
-  else if (_wcsicmp(pszParam, L"includeOptional") == 0)
-    _includeOptional=true;
-  else if (_wcsicmp(pszParam, L"installedSupport") == 0)
-    _installedSupport=true;
-  else if (_wcsicmp(pszParam, L"noDpc") == 0)
-    _enableDpc=false;
-  else if (_wcsicmp(pszParam, L"noHdri") == 0)
-    _useHDRI=false;
-  else if (_wcsicmp(pszParam, L"noOpenMP") == 0)
-    _useOpenMP=false;
-  else if (_wcsicmp(pszParam, L"noWizard") == 0)
-    _noWizard=true;
-  else if (_wcsicmp(pszParam, L"LimitedPolicy") == 0)
-    _policyConfig=PolicyConfig::LIMITED;
-  else if (_wcsicmp(pszParam, L"openCL") == 0)
-    _useOpenCL=true;
-  else if (_wcsicmp(pszParam, L"OpenPolicy") == 0)
-    _policyConfig=PolicyConfig::OPEN;
-  else if (_wcsicmp(pszParam, L"Q8") == 0)
-    _quantumDepth=QuantumDepth::Q8;
-  else if (_wcsicmp(pszParam, L"Q16") == 0)
-    _quantumDepth=QuantumDepth::Q16;
-  else if (_wcsicmp(pszParam, L"Q32") == 0)
-    _quantumDepth=QuantumDepth::Q32;
-  else if (_wcsicmp(pszParam, L"Q64") == 0)
-    _quantumDepth=QuantumDepth::Q64;
-  else if (_wcsicmp(pszParam, L"SecurePolicy") == 0)
-    _policyConfig=PolicyConfig::SECURE;
-  else if (_wcsicmp(pszParam, L"x86") == 0)
-    _platform=Platform::X86;
-  else if (_wcsicmp(pszParam, L"x64") == 0)
-    _platform=Platform::X64;
-  else if (_wcsicmp(pszParam, L"VS2017") == 0)
-    _visualStudioVersion=VisualStudioVersion::VS2017;
-  else if (_wcsicmp(pszParam, L"VS2019") == 0)
-    _visualStudioVersion=VisualStudioVersion::VS2019;
-  else if (_wcsicmp(pszParam, L"VS2022") == 0)
-    _visualStudioVersion=VisualStudioVersion::VS2022;
-  else if (_wcsicmp(pszParam, L"WebSafePolicy") == 0)
-    _policyConfig=PolicyConfig::WEBSAFE;
-  else if (_wcsicmp(pszParam, L"zeroConfigurationSupport") == 0)
-    _zeroConfigurationSupport=true;
-}
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "stdafx.h"
+#include "CommandLineInfo.h"
+
+CommandLineInfo::CommandLineInfo(const ConfigureWizard &wizard)
+{
+  _platform=wizard.platform();
+  _avx2Modules=wizard.avx2Modules();
+  _cacheableDebugInfo=wizard.cacheableDebugInfo();
+  _compilerLauncher=wizard.compilerLauncher();
+  _delayLoadDelegates=wizard.delayLoadDelegates();
+  _delegateSdk=wizard.delegateSdk();
+  _enableDpc=wizard.enableDpc();
+  _excludeDeprecated=wizard.excludeDeprecated();
+  _flatCMake=wizard.flatCMake();
+  _formats=wizard.formats();
+  _includeIncompatibleLicense=wizard.includeIncompatibleLicense();
+  _includeOptional=wizard.includeOptional();
+  _installedSupport=wizard.installedSupport();
+  _memoryBudget=wizard.memoryBudget();
+  _moduleShards=wizard.moduleShards();
+  _noWizard=false;
+  _objectLibraries=wizard.objectLibraries();
+  _policyConfig=wizard.policyConfig();
+  _quantumDepth=wizard.quantumDepth();
+  _solutionType=wizard.solutionType();
+  _targetIsa=wizard.targetIsa();
+  _targetLinux=wizard.targetLinux();
+  _useHDRI=wizard.useHDRI();
+  _useOpenCL=true;
+  _useOpenMP=wizard.useOpenMP();
+  _variants=wizard.variants();
+  _visualStudioVersion=wizard.visualStudioVersion();
+  _zeroConfigurationSupport=wizard.zeroConfigurationSupport();
+}
+
+CommandLineInfo::CommandLineInfo(const CommandLineInfo& obj)
+{
+  *this = obj;
+}
+
+CommandLineInfo& CommandLineInfo::operator=(const CommandLineInfo& obj)
+{
+  return *this;
+}
+
+bool CommandLineInfo::avx2Modules() const
+{
+  return(_avx2Modules);
+}
+
+bool CommandLineInfo::cacheableDebugInfo() const
+{
+  return(_cacheableDebugInfo);
+}
+
+wstring CommandLineInfo::compilerLauncher() const
+{
+  return(_compilerLauncher);
+}
+
+bool CommandLineInfo::delayLoadDelegates() const
+{
+  return(_delayLoadDelegates);
+}
+
+bool CommandLineInfo::delegateSdk() const
+{
+  return(_delegateSdk);
+}
+
+bool CommandLineInfo::enableDpc() const
+{
+  return(_enableDpc);
+}
+
+bool CommandLineInfo::excludeDeprecated() const
+{
+  return(_excludeDeprecated);
+}
+
+bool CommandLineInfo::flatCMake() const
+{
+  return(_flatCMake);
+}
+
+vector<wstring> CommandLineInfo::formats() const
+{
+  return(_formats);
+}
+
+bool CommandLineInfo::includeIncompatibleLicense() const
+{
+  return(_includeIncompatibleLicense);
+}
+
+bool CommandLineInfo::includeOptional() const
+{
+  return(_includeOptional);
+}
+
+bool CommandLineInfo::installedSupport() const
+{
+  return(_installedSupport);
+}
+
+int CommandLineInfo::memoryBudget() const
+{
+  return(_memoryBudget);
+}
+
+int CommandLineInfo::moduleShards() const
+{
+  return(_moduleShards);
+}
+
+bool CommandLineInfo::noWizard() const
+{
+  return(_noWizard);
+}
+
+bool CommandLineInfo::objectLibraries() const
+{
+  return(_objectLibraries);
+}
+
+Platform CommandLineInfo::platform() const
+{
+  return(_platform);
+}
+
+PolicyConfig CommandLineInfo::policyConfig() const
+{
+  return(_policyConfig);
+}
+
+QuantumDepth CommandLineInfo::quantumDepth() const
+{
+  return(_quantumDepth);
+}
+
+SolutionType CommandLineInfo::solutionType() const
+{
+  return(_solutionType);
+}
+
+TargetIsa CommandLineInfo::targetIsa() const
+{
+  return(_targetIsa);
+}
+
+bool CommandLineInfo::targetLinux() const
+{
+  return(_targetLinux);
+}
+
+bool CommandLineInfo::useHDRI() const
+{
+  return(_useHDRI);
+}
+
+bool CommandLineInfo::useOpenCL() const
+{
+  return(_useOpenCL);
+}
+
+bool CommandLineInfo::useOpenMP() const
+{
+  return(_useOpenMP);
+}
+
+vector<wstring> CommandLineInfo::variants() const
+{
+  return(_variants);
+}
+
+VisualStudioVersion CommandLineInfo::visualStudioVersion() const
+{
+  return(_visualStudioVersion);
+}
+
+bool CommandLineInfo::zeroConfigurationSupport() const
+{
+  return(_zeroConfigurationSupport);
+}
+
+void CommandLineInfo::ParseParam(const wchar_t* pszParam, BOOL bFlag, BOOL bLast)
+{
+  wstring
+    format,
+    variant;
+
+  if (!bFlag)
+    return;
+
+  /* Also accept the --option syntax */
+  while (*pszParam == L'-')
+    pszParam++;
+
+  if (_wcsicmp(pszParam, L"arm64") == 0)
+    _platform=Platform::ARM64;
+  else if (_wcsicmp(pszParam, L"avx2Modules") == 0)
+    _avx2Modules=true;
+  else if (_wcsicmp(pszParam, L"cacheableDebugInfo") == 0)
+    _cacheableDebugInfo=true;
+  else if (_wcsnicmp(pszParam, L"compilerLauncher=", 17) == 0)
+    _compilerLauncher=pszParam + 17;
+  else if (_wcsicmp(pszParam, L"delayLoad") == 0)
+    _delayLoadDelegates=true;
+  else if (_wcsicmp(pszParam, L"delegateSdk") == 0)
+    _delegateSdk=true;
+  else if (_wcsicmp(pszParam, L"dmt") == 0)
+    _solutionType=SolutionType::DYNAMIC_MT;
+  else if (_wcsicmp(pszParam, L"deprecated") == 0)
+    _excludeDeprecated=FALSE;
+  else if (_wcsicmp(pszParam, L"flatCMake") == 0)
+    _flatCMake=true;
+  /* The format list is only supported by the dynamic builds and only builds the libraries, coders and filters */
+  else if (_wcsnicmp(pszParam, L"formats=", 8) == 0)
+  {
+    wstringstream
+      formats(pszParam + 8);
+
+    _formats.clear();
+    while (getline(formats,format,L','))
+    {
+      format=toLower(trim(format));
+      if (!format.empty() && !contains(_formats,format))
+        _formats.push_back(format);
+    }
+  }
+  else if (_wcsicmp(pszParam, L"smt") == 0)
+    _solutionType=SolutionType::STATIC_MT;
+  else if (_wcsicmp(pszParam, L"smtd") == 0)
+    _solutionType=SolutionType::STATIC_MTD;
+  else if (_wcsicmp(pszParam, L"hdri") == 0)
+    _useHDRI=true;
+  else if (_wcsicmp(pszParam, L"incompatibleLicense") == 0)
+     _includeIncompatibleLicense=true;
+  else if (_wcsicmp(pszParam, L"includeOptional") == 0)
+    _includeOptional=true;
+  else if (_wcsnicmp(pszParam, L"isa=", 4) == 0)
+    _targetIsa=parseTargetIsa(toLower(pszParam + 4));
+  else if (_wcsicmp(pszParam, L"installedSupport") == 0)
+    _installedSupport=true;
+  else if (_wcsnicmp(pszParam, L"memoryBudget=", 13) == 0)
+    _memoryBudget=max(_wtoi(pszParam + 13),0);
+  else if (_wcsnicmp(pszParam, L"moduleShards=", 13) == 0)
+    _moduleShards=max(_wtoi(pszParam + 13),0);
+  else if (_wcsicmp(pszParam, L"noDpc") == 0)
+    _enableDpc=false;
+  else if (_wcsicmp(pszParam, L"noHdri") == 0)
+    _useHDRI=false;
+  else if (_wcsicmp(pszParam, L"noOpenMP") == 0)
+    _useOpenMP=false;
+  else if (_wcsicmp(pszParam, L"noWizard") == 0)
+    _noWizard=true;
+  else if (_wcsicmp(pszParam, L"objectLibraries") == 0)
+    _objectLibraries=true;
+  else if (_wcsicmp(pszParam, L"linux") == 0)
+    _targetLinux=true;
+  else if (_wcsicmp(pszParam, L"LimitedPolicy") == 0)
+    _policyConfig=PolicyConfig::LIMITED;
+  else if (_wcsicmp(pszParam, L"openCL") == 0)
+    _useOpenCL=true;
+  else if (_wcsicmp(pszParam, L"OpenPolicy") == 0)
+    _policyConfig=PolicyConfig::OPEN;
+  else if (_wcsicmp(pszParam, L"Q8") == 0)
+    _quantumDepth=QuantumDepth::Q8;
+  else if (_wcsicmp(pszParam, L"Q16") == 0)
+    _quantumDepth=QuantumDepth::Q16;
+  else if (_wcsicmp(pszParam, L"Q32") == 0)
+    _quantumDepth=QuantumDepth::Q32;
+  else if (_wcsicmp(pszParam, L"Q64") == 0)
+    _quantumDepth=QuantumDepth::Q64;
+  else if (_wcsicmp(pszParam, L"SecurePolicy") == 0)
+    _policyConfig=PolicyConfig::SECURE;
+  else if (_wcsicmp(pszParam, L"x86") == 0)
+    _platform=Platform::X86;
+  else if (_wcsicmp(pszParam, L"x64") == 0)
+    _platform=Platform::X64;
+  else if (_wcsnicmp(pszParam, L"variants=", 9) == 0)
+  {
+    wstringstream
+      variants(pszParam + 9);
+
+    _variants.clear();
+    while (getline(variants,variant,L','))
+    {
+      variant=trim(variant);
+      transform(variant.begin(),variant.end(),variant.begin(),::towupper);
+      if (!variant.empty() && !contains(_variants,variant))
+        _variants.push_back(variant);
+    }
+  }
+  else if (_wcsicmp(pszParam, L"VS2017") == 0)
+    _visualStudioVersion=VisualStudioVersion::VS2017;
+  else if (_wcsicmp(pszParam, L"VS2019") == 0)
+    _visualStudioVersion=VisualStudioVersion::VS2019;
+  else if (_wcsicmp(pszParam, L"VS2022") == 0)
+    _visualStudioVersion=VisualStudioVersion::VS2022;
+  else if (_wcsicmp(pszParam, L"WebSafePolicy") == 0)
+    _policyConfig=PolicyConfig::WEBSAFE;
+  else if (_wcsicmp(pszParam, L"zeroConfigurationSupport") == 0)
+    _zeroConfigurationSupport=true;
+}
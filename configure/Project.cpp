@@ -1,548 +1,860 @@
-/*
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-%                                                                             %
-%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
-%  dedicated to making software imaging solutions freely available.           %
-%                                                                             %
-%  You may not use this file except in compliance with the License.  You may  %
-%  obtain a copy of the License at                                            %
-%                                                                             %
-%    http://www.imagemagick.org/script/license.php                            %
-%                                                                             %
-%  Unless required by applicable law or agreed to in writing, software        %
-%  distributed under the License is distributed on an "AS IS" BASIS,          %
-%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
-%  See the License for the specific language governing permissions and        %
-%  limitations under the License.                                             %
-%                                                                             %
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-*/
-#include "stdafx.h"
-#include "Project.h"
-
-#include <algorithm>
-
-Compiler Project::compiler(VisualStudioVersion visualStudioVersion) const
-{
-  return(_magickProject && visualStudioVersion >= VisualStudioVersion::VS2022 ? Compiler::CPP : Compiler::Default);
-}
-
-wstring Project::configDefine() const
-{
-  return(_configDefine);
-}
-
-vector<wstring> &Project::defines()
-{
-  return(_defines);
-}
-
-vector<wstring> &Project::definesDll()
-{
-  return(_definesDll);
-}
-
-vector<wstring> &Project::definesLib()
-{
-  return(_definesLib);
-}
-
-vector<wstring> &Project::dependencies()
-{
-  return(_dependencies);
-}
-
-vector<wstring> &Project::directories()
-{
-  return(_directories);
-}
-
-vector<wstring> &Project::excludes()
-{
-  return(_excludes);
-}
-
-vector<ProjectFile*> &Project::files()
-{
-  return(_files);
-}
-
-vector<wstring> &Project::includes()
-{
-  return(_includes);
-}
-
-vector<wstring> &Project::includesNasm()
-{
-  return(_includesNasm);
-}
-
-vector<wstring> &Project::platformExcludes(Platform platform)
-{
-  switch (platform)
-  {
-    case Platform::X86: return(_excludesX86);
-    case Platform::X64: return(_excludesX64);
-    case Platform::ARM64: return(_excludesARM64);
-    default: throw;
-  }
-}
-
-wstring Project::icon() const
-{
-  return _icon;
-}
-
-bool Project::isConsole() const
-{
-  if (!isExe())
-    return(false);
-  return(_type != ProjectType::APPTYPE);
-}
-
-bool Project::isDll() const
-{
-  return((_type == ProjectType::DLLTYPE) || (_type == ProjectType::DLLMODULETYPE));
-}
-
-bool Project::isExe() const
-{
-  return((_type == ProjectType::EXETYPE) || (_type == ProjectType::EXEMODULETYPE) || (_type == ProjectType::APPTYPE));
-}
-
-bool Project::isFuzz() const
-{
-  return(_modulePrefix == L"FUZZ");
-}
-
-bool Project::isLib() const
-{
-  return((_type == ProjectType::STATICTYPE));
-}
-
-bool Project::isModule() const
-{
-  return((_type == ProjectType::DLLMODULETYPE) || (_type == ProjectType::EXEMODULETYPE));
-}
-
-bool Project::isOptimizationDisable() const
-{
-  return(_disableOptimization);
-}
-
-bool Project::isSupported(const VisualStudioVersion visualStudioVersion) const
-{
-  return(visualStudioVersion >= _minimumVisualStudioVersion);
-}
-
-vector<wstring> &Project::libraries()
-{
-  return(_libraries);
-}
-
-wstring Project::moduleDefinitionFile() const
-{
-  return(_moduleDefinitionFile);
-}
-
-wstring Project::name() const
-{
-  return(_name);
-}
-
-wstring Project::notice() const
-{
-  return(_notice);
-}
-
-vector<wstring> &Project::references()
-{
-  return(_references);
-}
-
-bool Project::treatWarningAsError() const
-{
-  return(_magickProject);
-}
-
-bool Project::useNasm() const
-{
-  return(_useNasm);
-}
-
-bool Project::useUnicode() const
-{
-  return(_useUnicode);
-}
-
-wstring Project::version() const
-{
-  return _versions[0];
-}
-
-int Project::warningLevel() const
-{
-  return(_magickProject ? 4 : 0);
-}
-
-void Project::checkFiles(const VisualStudioVersion visualStudioVersion)
-{
-   std::vector<ProjectFile*>
-     newFiles(_files.size());
-
-  auto filter=[visualStudioVersion](ProjectFile* p){ return p->isSupported(visualStudioVersion); };
-  auto it=std::copy_if(_files.begin(),_files.end(),newFiles.begin(),filter);
-  newFiles.resize(std::distance(newFiles.begin(),it));
-  _files=newFiles;
-}
-
-void Project::mergeProjectFiles(const ConfigureWizard &wizard)
-{
-  ProjectFile
-    *projectFile;
-
-  if ((_type != ProjectType::DLLMODULETYPE) || (wizard.solutionType() == SolutionType::DYNAMIC_MT))
-    return;
-
-  projectFile=new ProjectFile(&wizard,this,L"CORE",_name);
-  foreach (ProjectFile*,pf,_files)
-  {
-    projectFile->merge((*pf));
-  }
-  _files.clear();
-  _files.push_back(projectFile);
-}
-
-Project* Project::create(wstring name)
-{
-  wifstream
-    config;
-
-  config.open(L"..\\" + name + L"\\Config.txt");
-  if (!config)
-    return((Project *) NULL);
-
-  Project* project = new Project(name);
-  project->loadConfig(config);
-  project->setNoticeAndVersion();
-
-  config.close();
-  return(project);
-}
-
-bool Project::loadFiles(const ConfigureWizard &wizard)
-{
-  ProjectFile
-    *projectFile;
-
-  _files.clear();
-
-  if (shouldSkip(wizard))
-    return(false);
-
-  switch(_type)
-  {
-    case ProjectType::DLLMODULETYPE:
-    {
-      loadModules(wizard);
-      break;
-    }
-    case ProjectType::DLLTYPE:
-    {
-      projectFile=new ProjectFile(&wizard,this,L"CORE",_name);
-      _files.push_back(projectFile);
-      break;
-    }
-    case ProjectType::APPTYPE:
-    case ProjectType::EXETYPE:
-    {
-      projectFile=new ProjectFile(&wizard,this,L"UTIL",_name);
-      _files.push_back(projectFile);
-      break;
-    }
-    case ProjectType::EXEMODULETYPE:
-    {
-      loadModules(wizard);
-      break;
-    }
-    case ProjectType::STATICTYPE:
-    {
-      projectFile=new ProjectFile(&wizard,this,L"CORE",_name);
-      _files.push_back(projectFile);
-      break;
-    }
-  }
-
-  return(true);
-}
-
-bool Project::shouldSkip(const ConfigureWizard &wizard)
-{
-  if (_disabledARM64 && wizard.platform() == Platform::ARM64)
-    return(true);
-
-  if (_hasIncompatibleLicense && !wizard.includeIncompatibleLicense())
-    return(true);
-
-  if (_isOptional && !wizard.includeOptional())
-    return(true);
-
-  return(false);
-}
-
-Project::Project(wstring name)
-{
-  _name=name;
-
-  _disabledARM64=false;
-  _disableOptimization=false;
-  _hasIncompatibleLicense=false;
-  _isOptional=false;
-  _minimumVisualStudioVersion=VSEARLIEST;
-  _type=ProjectType::UNDEFINEDTYPE;
-  _useNasm=false;
-  _useUnicode=false;
-  _magickProject=false;
-}
-
-void Project::addLines(wifstream &config,wstring &value)
-{
-  wstring
-    line;
-
-  while (!config.eof())
-  {
-    getline(config,line);
-    if (trim(line).empty())
-      return;
-
-    value+=line+L"\n";
-  }
-}
-
-void Project::addLines(wifstream &config,vector<wstring> &container)
-{
-  wstring
-    line;
-
-  while (!config.eof())
-  {
-    line=readLine(config);
-    if (line.empty())
-      return;
-
-    // replace all \\ to / in line
-    std::replace(line.begin(), line.end(), L'\\', L'/');
-
-    container.push_back(line);
-  }
-}
-
-void Project::loadConfig(wifstream &config)
-{
-  wstring
-    line;
-
-  while (!config.eof())
-  {
-    line=readLine(config);
-    if (line == L"[APP]")
-      _type=ProjectType::APPTYPE;
-    else if (line == L"[CONFIG_DEFINE]")
-      addLines(config,_configDefine);
-    else if (line == L"[DEFINES_DLL]")
-      addLines(config,_definesDll);
-    else if (line == L"[DEFINES_LIB]")
-      addLines(config,_definesLib);
-    else if (line == L"[DEFINES]")
-      addLines(config,_defines);
-    else if (line == L"[DEPENDENCIES]")
-      addLines(config,_dependencies);
-    else if (line == L"[DIRECTORIES]")
-      addLines(config,_directories);
-    else if (line == L"[DISABLED_ARM64]")
-      _disabledARM64=true;
-    else if (line == L"[DISABLE_OPTIMIZATION]")
-      _disableOptimization=true;
-    else if (line == L"[DLL]")
-      _type=ProjectType::DLLTYPE;
-    else if (line == L"[DLLMODULE]")
-      _type=ProjectType::DLLMODULETYPE;
-    else if (line == L"[EXE]")
-      _type=ProjectType::EXETYPE;
-    else if (line == L"[EXEMODULE]")
-      _type=ProjectType::EXEMODULETYPE;
-    else if (line == L"[EXCLUDES]")
-      addLines(config,_excludes);
-    else if (line == L"[EXCLUDES_X86]")
-      addLines(config,_excludesX86);
-    else if (line == L"[EXCLUDES_X64]")
-      addLines(config,_excludesX64);
-    else if (line == L"[EXCLUDES_ARM64]")
-      addLines(config,_excludesARM64);
-    else if (line == L"[ICON]")
-      _icon=readLine(config);
-    else if (line == L"[INCLUDES]")
-      addLines(config,_includes);
-    else if (line == L"[INCLUDES_NASM]")
-      addLines(config,_includesNasm);
-    else if (line == L"[INCOMPATIBLE_LICENSE]")
-      _hasIncompatibleLicense=true;
-    else if (line == L"[STATIC]")
-      _type=ProjectType::STATICTYPE;
-    else if (line == L"[LIBRARIES]")
-      addLines(config,_libraries);
-    else if (line == L"[MODULE_DEFINITION_FILE]")
-      _moduleDefinitionFile=readLine(config);
-    else if (line == L"[MODULE_PREFIX]")
-      _modulePrefix=readLine(config);
-    else if (line == L"[NASM]")
-      _useNasm=true;
-    else if (line == L"[OPTIONAL]")
-      _isOptional=true;
-    else if (line == L"[REFERENCES]")
-      addLines(config,_references);
-    else if (line == L"[UNICODE]")
-      _useUnicode=true;
-    else if (line == L"[VISUAL_STUDIO]")
-      _minimumVisualStudioVersion=parseVisualStudioVersion(readLine(config));
-    else if (line == L"[MAGICK_PROJECT]")
-      _magickProject=true;
-    else if (line == L"[LICENSE]")
-      _licenseFileNames=readLicenseFilenames(readLine(config));
-  }
-}
-
-void Project::loadModules(const ConfigureWizard &wizard)
-{
-  HANDLE
-    fileHandle;
-
-  ProjectFile
-    *projectAlias,
-    *projectFile;
-
-  wstring
-    name;
-
-  WIN32_FIND_DATA
-    data;
-
-  foreach (wstring,dir,_directories)
-  {
-    const wstring
-      fileDir(L"../../" + *dir);
-
-    if (!directoryExists(fileDir))
-      throwException(L"Invalid folder specified: " + fileDir);
-
-    fileHandle=FindFirstFile((fileDir + L"/*.*").c_str(),&data);
-    do
-    {
-      if (fileHandle == INVALID_HANDLE_VALUE)
-        return;
-
-      if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == FILE_ATTRIBUTE_DIRECTORY)
-        continue;
-
-      if (contains(_excludes,data.cFileName))
-        continue;
-
-      if (startsWith(data.cFileName,L"main."))
-        continue;
-
-      name=data.cFileName;
-
-      if (!isValidSrcFile(data.cFileName))
-        continue;
-
-      name=name.substr(0,name.find_last_of(L"."));
-      projectFile=new ProjectFile(&wizard,this,_modulePrefix,name);
-      _files.push_back(projectFile);
-
-      foreach(wstring,alias,projectFile->aliases())
-      {
-        projectAlias=new ProjectFile(&wizard,this,_modulePrefix,*alias,name);
-        _files.push_back(projectAlias);
-      }
-
-    } while (FindNextFile(fileHandle,&data));
-  }
-}
-
-vector<wstring> Project::readLicenseFilenames(const wstring &line)
-{
-  wstring
-    fileName;
-
-  vector<wstring>
-    fileNames;
-
-  wstringstream
-    wss(line);
-
-  while(getline(wss, fileName, L';'))
-  {
-    wstring
-      filePath(L"..\\..\\" + name() + L"\\" + fileName);
-
-    filesystem::path
-      file(filePath);
-
-    if (!filesystem::exists(file))
-      throwException(L"Unable to open license file: " + fileName);
-
-    fileNames.push_back(filePath);
-  }
-
-  return (fileNames);
-}
-
-void Project::setNoticeAndVersion()
-{
-  _notice=L"";
-  foreach(wstring,licenseFileName,_licenseFileNames)
-  {
-    filesystem::path
-      folder,
-      versionFile;
-
-    wifstream
-      version;
-
-    wstring
-      versionFileName;
-
-    folder=filesystem::path(*licenseFileName).parent_path();
-    versionFileName=folder.wstring()+L"\\ImageMagick\\ImageMagick.version.h";
-    versionFile=filesystem::path(versionFileName).wstring();
-    if (!filesystem::exists(versionFile))
-      {
-        folder=folder.parent_path();
-        versionFileName=folder.wstring()+L"\\ImageMagick\\ImageMagick.version.h";
-        versionFile=filesystem::path(versionFileName).wstring();
-        if (!filesystem::exists(versionFile))
-          throwException(L"Unable to find version file for: " + _name);
-      }
-
-    version.open(versionFileName);
-    while (!version.eof())
-    {
-      wstring
-        line;
-
-      line=readLine(version);
-      if (!startsWith(line,L"DELEGATE_VERSION_NUM"))
-        continue;
-
-      line=line.substr(line.find_last_of(L" "));
-      line=replace(line,L",",L".");
-      _versions.push_back(line);
-      break;
-    }
-    version.close();
-
-    _notice+=L"[ "+folder.stem().wstring()+_versions.back()+L" ] copyright:\r\n";
-    _notice+=readLicense(*licenseFileName)+L"\r\n";
-  }
-}
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "stdafx.h"
+#include "Project.h"
+
+#include <algorithm>
+#include <map>
+
+Compiler Project::compiler(VisualStudioVersion visualStudioVersion) const
+{
+  return(_magickProject && visualStudioVersion >= VisualStudioVersion::VS2022 ? Compiler::CPP : Compiler::Default);
+}
+
+wstring Project::configDefine() const
+{
+  return(_configDefine);
+}
+
+bool Project::delayLoad() const
+{
+  return(_delayLoad);
+}
+
+vector<wstring> &Project::defines()
+{
+  return(_defines);
+}
+
+vector<wstring> &Project::definesDll()
+{
+  return(_definesDll);
+}
+
+vector<wstring> &Project::definesLib()
+{
+  return(_definesLib);
+}
+
+vector<wstring> &Project::definesLinux()
+{
+  return(_definesLinux);
+}
+
+vector<wstring> &Project::dependencies()
+{
+  return(_dependencies);
+}
+
+vector<wstring> &Project::dependenciesInterface()
+{
+  return(_dependenciesInterface);
+}
+
+vector<wstring> &Project::dependenciesPrivate()
+{
+  return(_dependenciesPrivate);
+}
+
+vector<wstring> &Project::directories()
+{
+  return(_directories);
+}
+
+vector<wstring> &Project::excludes()
+{
+  return(_excludes);
+}
+
+vector<wstring> &Project::excludesMsvc()
+{
+  return(_excludesMsvc);
+}
+
+vector<ProjectFile*> &Project::files()
+{
+  return(_files);
+}
+
+vector<wstring> &Project::includes()
+{
+  return(_includes);
+}
+
+vector<wstring> &Project::includesInterface()
+{
+  return(_includesInterface);
+}
+
+vector<wstring> &Project::includesNasm()
+{
+  return(_includesNasm);
+}
+
+vector<wstring> &Project::includesPrivate()
+{
+  return(_includesPrivate);
+}
+
+vector<wstring> &Project::platformDefines(Platform platform)
+{
+  switch (platform)
+  {
+    case Platform::X86: return(_definesX86);
+    case Platform::X64: return(_definesX64);
+    case Platform::ARM64: return(_definesARM64);
+    default: throw;
+  }
+}
+
+vector<wstring> &Project::platformExcludes(Platform platform)
+{
+  switch (platform)
+  {
+    case Platform::X86: return(_excludesX86);
+    case Platform::X64: return(_excludesX64);
+    case Platform::ARM64: return(_excludesARM64);
+    default: throw;
+  }
+}
+
+wstring Project::icon() const
+{
+  return _icon;
+}
+
+bool Project::isConsole() const
+{
+  if (!isExe())
+    return(false);
+  return(_type != ProjectType::APPTYPE);
+}
+
+bool Project::isDll() const
+{
+  return((_type == ProjectType::DLLTYPE) || (_type == ProjectType::DLLMODULETYPE));
+}
+
+bool Project::isExe() const
+{
+  return((_type == ProjectType::EXETYPE) || (_type == ProjectType::EXEMODULETYPE) || (_type == ProjectType::APPTYPE));
+}
+
+bool Project::isFuzz() const
+{
+  return(_modulePrefix == L"FUZZ");
+}
+
+bool Project::isLib() const
+{
+  return((_type == ProjectType::STATICTYPE));
+}
+
+bool Project::isMagickProject() const
+{
+  return(_magickProject);
+}
+
+bool Project::isModule() const
+{
+  return((_type == ProjectType::DLLMODULETYPE) || (_type == ProjectType::EXEMODULETYPE));
+}
+
+bool Project::isOptimizationDisable() const
+{
+  return(_disableOptimization);
+}
+
+bool Project::isSupported(const VisualStudioVersion visualStudioVersion) const
+{
+  return(visualStudioVersion >= _minimumVisualStudioVersion);
+}
+
+vector<pair<wstring,wstring>> &Project::formatModules()
+{
+  return(_formatModules);
+}
+
+vector<wstring> &Project::libraries()
+{
+  return(_libraries);
+}
+
+wstring Project::moduleDefinitionFile() const
+{
+  return(_moduleDefinitionFile);
+}
+
+wstring Project::modulePrefix() const
+{
+  return(_modulePrefix);
+}
+
+vector<wstring> &Project::modules()
+{
+  return(_modules);
+}
+
+wstring Project::name() const
+{
+  return(_name);
+}
+
+wstring Project::notice() const
+{
+  return(_notice);
+}
+
+vector<wstring> &Project::references()
+{
+  return(_references);
+}
+
+vector<wstring> &Project::rtcd()
+{
+  return(_rtcd);
+}
+
+wstring Project::rtcdConfig() const
+{
+  return(_rtcdConfig);
+}
+
+wstring Project::rtcdScript() const
+{
+  return(_rtcdScript);
+}
+
+vector<wstring> &Project::sourceIsa()
+{
+  return(_sourceIsa);
+}
+
+vector<wstring> &Project::tests()
+{
+  return(_tests);
+}
+
+vector<wstring> &Project::tools()
+{
+  return(_tools);
+}
+
+bool Project::treatWarningAsError() const
+{
+  return(_magickProject);
+}
+
+bool Project::useNasm() const
+{
+  return(_useNasm);
+}
+
+bool Project::useThreads() const
+{
+  return(_useThreads);
+}
+
+bool Project::useUnicode() const
+{
+  return(_useUnicode);
+}
+
+wstring Project::version() const
+{
+  return _versions[0];
+}
+
+int Project::warningLevel() const
+{
+  return(_magickProject ? 4 : 0);
+}
+
+void Project::checkFiles(const VisualStudioVersion visualStudioVersion)
+{
+   std::vector<ProjectFile*>
+     newFiles(_files.size());
+
+  auto filter=[visualStudioVersion](ProjectFile* p){ return p->isSupported(visualStudioVersion); };
+  auto it=std::copy_if(_files.begin(),_files.end(),newFiles.begin(),filter);
+  newFiles.resize(std::distance(newFiles.begin(),it));
+  _files=newFiles;
+}
+
+void Project::createIsaModules(const ConfigureWizard &wizard)
+{
+  ProjectFile
+    *projectFile;
+
+  size_t
+    count;
+
+  if ((_type != ProjectType::DLLMODULETYPE) || (wizard.solutionType() != SolutionType::DYNAMIC_MT))
+    return;
+
+  /* The AVX2 modules are built next to the baseline modules */
+  count=_files.size();
+  for (size_t i=0; i < count; i++)
+  {
+    projectFile=new ProjectFile(*_files[i]);
+    projectFile->isa(L"avx2");
+    _files.push_back(projectFile);
+  }
+}
+
+void Project::createVariants(const ConfigureWizard &wizard)
+{
+  ProjectFile
+    *projectFile;
+
+  vector<ProjectFile*>
+    newFiles;
+
+  if (wizard.variants().empty())
+    return;
+
+  foreach (ProjectFile*,pf,_files)
+  {
+    foreach_const (wstring,variant,wizard.variants())
+    {
+      projectFile=new ProjectFile(**pf);
+      projectFile->variant(*variant);
+      newFiles.push_back(projectFile);
+    }
+  }
+  _files=newFiles;
+}
+
+void Project::mergeProjectFiles(const ConfigureWizard &wizard)
+{
+  ProjectFile
+    *projectFile;
+
+  if (_type != ProjectType::DLLMODULETYPE)
+    return;
+
+  if (wizard.solutionType() == SolutionType::DYNAMIC_MT)
+  {
+    if (wizard.moduleShards() > 0)
+      shardProjectFiles(wizard);
+    return;
+  }
+
+  _formatModules.clear();
+  _modules.clear();
+  projectFile=new ProjectFile(&wizard,this,L"CORE",_name);
+  foreach (ProjectFile*,pf,_files)
+  {
+    projectFile->merge((*pf));
+    _modules.push_back((*pf)->moduleName());
+    /* A module registers the format with its own name and the formats of its Config file */
+    _formatModules.push_back(make_pair(toUpper((*pf)->moduleName()),(*pf)->moduleName()));
+    foreach (wstring,format,(*pf)->formats())
+    {
+      _formatModules.push_back(make_pair(toUpper(*format),(*pf)->moduleName()));
+    }
+  }
+  sort(_modules.begin(),_modules.end());
+  _files.clear();
+  _files.push_back(projectFile);
+}
+
+void Project::exclude()
+{
+  _isExcluded=true;
+}
+
+void Project::removeFiles(const vector<wstring> &keepModules)
+{
+  auto filter=[keepModules](ProjectFile* p){ return !contains(keepModules,p->moduleName()); };
+  _files.erase(std::remove_if(_files.begin(),_files.end(),filter),_files.end());
+}
+
+Project* Project::create(wstring name)
+{
+  wifstream
+    config;
+
+  config.open(L"..\\" + name + L"\\Config.txt");
+  if (!config)
+    return((Project *) NULL);
+
+  Project* project = new Project(name);
+  project->loadConfig(config);
+  project->setNoticeAndVersion();
+
+  config.close();
+  return(project);
+}
+
+bool Project::loadFiles(const ConfigureWizard &wizard)
+{
+  ProjectFile
+    *projectFile;
+
+  _files.clear();
+
+  if (shouldSkip(wizard))
+    return(false);
+
+  switch(_type)
+  {
+    case ProjectType::DLLMODULETYPE:
+    {
+      loadModules(wizard);
+      break;
+    }
+    case ProjectType::DLLTYPE:
+    {
+      projectFile=new ProjectFile(&wizard,this,L"CORE",_name);
+      _files.push_back(projectFile);
+      break;
+    }
+    case ProjectType::APPTYPE:
+    case ProjectType::EXETYPE:
+    {
+      projectFile=new ProjectFile(&wizard,this,L"UTIL",_name);
+      _files.push_back(projectFile);
+      break;
+    }
+    case ProjectType::EXEMODULETYPE:
+    {
+      loadModules(wizard);
+      break;
+    }
+    case ProjectType::STATICTYPE:
+    {
+      projectFile=new ProjectFile(&wizard,this,L"CORE",_name);
+      _files.push_back(projectFile);
+      break;
+    }
+  }
+
+  return(true);
+}
+
+bool Project::shouldSkip(const ConfigureWizard &wizard)
+{
+  if (_isExcluded)
+    return(true);
+
+  if (_disabledARM64 && wizard.platform() == Platform::ARM64)
+    return(true);
+
+  if (_hasIncompatibleLicense && !wizard.includeIncompatibleLicense())
+    return(true);
+
+  if (_isOptional && !wizard.includeOptional())
+    return(true);
+
+  /* The MFC applications can only be build for Windows */
+  if ((_type == ProjectType::APPTYPE) && wizard.targetLinux())
+    return(true);
+
+  return(false);
+}
+
+Project::Project(wstring name)
+{
+  _name=name;
+
+  _delayLoad=false;
+  _disabledARM64=false;
+  _disableOptimization=false;
+  _hasIncompatibleLicense=false;
+  _isExcluded=false;
+  _isOptional=false;
+  _minimumVisualStudioVersion=VSEARLIEST;
+  _type=ProjectType::UNDEFINEDTYPE;
+  _useNasm=false;
+  _useThreads=false;
+  _useUnicode=false;
+  _magickProject=false;
+}
+
+void Project::addLines(wifstream &config,wstring &value)
+{
+  wstring
+    line;
+
+  while (!config.eof())
+  {
+    getline(config,line);
+    if (trim(line).empty())
+      return;
+
+    value+=line+L"\n";
+  }
+}
+
+void Project::addLines(wifstream &config,vector<wstring> &container)
+{
+  wstring
+    line;
+
+  while (!config.eof())
+  {
+    line=readLine(config);
+    if (line.empty())
+      return;
+
+    // replace all \\ to / in line
+    std::replace(line.begin(), line.end(), L'\\', L'/');
+
+    container.push_back(line);
+  }
+}
+
+void Project::loadConfig(wifstream &config)
+{
+  wstring
+    line;
+
+  while (!config.eof())
+  {
+    line=readLine(config);
+    if (line == L"[AFFINITIES]")
+      addLines(config,_affinities);
+    else if (line == L"[APP]")
+      _type=ProjectType::APPTYPE;
+    else if (line == L"[CONFIG_DEFINE]")
+      addLines(config,_configDefine);
+    else if (line == L"[DELAY_LOAD]")
+      _delayLoad=true;
+    else if (line == L"[DEFINES_DLL]")
+      addLines(config,_definesDll);
+    else if (line == L"[DEFINES_LIB]")
+      addLines(config,_definesLib);
+    else if (line == L"[DEFINES]")
+      addLines(config,_defines);
+    else if (line == L"[DEFINES_X86]")
+      addLines(config,_definesX86);
+    else if (line == L"[DEFINES_X64]")
+      addLines(config,_definesX64);
+    else if (line == L"[DEFINES_ARM64]")
+      addLines(config,_definesARM64);
+    else if (line == L"[DEFINES_LINUX]")
+      addLines(config,_definesLinux);
+    else if (line == L"[DEPENDENCIES]")
+      addLines(config,_dependencies);
+    else if (line == L"[DEPENDENCIES_INTERFACE]")
+      addScopedLines(config,_dependencies,_dependenciesInterface);
+    else if (line == L"[DEPENDENCIES_PRIVATE]")
+      addScopedLines(config,_dependencies,_dependenciesPrivate);
+    else if (line == L"[DIRECTORIES]")
+      addLines(config,_directories);
+    else if (line == L"[DISABLED_ARM64]")
+      _disabledARM64=true;
+    else if (line == L"[DISABLE_OPTIMIZATION]")
+      _disableOptimization=true;
+    else if (line == L"[DLL]")
+      _type=ProjectType::DLLTYPE;
+    else if (line == L"[DLLMODULE]")
+      _type=ProjectType::DLLMODULETYPE;
+    else if (line == L"[EXE]")
+      _type=ProjectType::EXETYPE;
+    else if (line == L"[EXEMODULE]")
+      _type=ProjectType::EXEMODULETYPE;
+    else if (line == L"[EXCLUDES]")
+      addLines(config,_excludes);
+    else if (line == L"[EXCLUDES_MSVC]")
+      addLines(config,_excludesMsvc);
+    else if (line == L"[EXCLUDES_X86]")
+      addLines(config,_excludesX86);
+    else if (line == L"[EXCLUDES_X64]")
+      addLines(config,_excludesX64);
+    else if (line == L"[EXCLUDES_ARM64]")
+      addLines(config,_excludesARM64);
+    else if (line == L"[ICON]")
+      _icon=readLine(config);
+    else if (line == L"[INCLUDES]")
+      addLines(config,_includes);
+    else if (line == L"[INCLUDES_INTERFACE]")
+      addScopedLines(config,_includes,_includesInterface);
+    else if (line == L"[INCLUDES_PRIVATE]")
+      addScopedLines(config,_includes,_includesPrivate);
+    else if (line == L"[INCLUDES_NASM]")
+      addLines(config,_includesNasm);
+    else if (line == L"[INCOMPATIBLE_LICENSE]")
+      _hasIncompatibleLicense=true;
+    else if (line == L"[STATIC]")
+      _type=ProjectType::STATICTYPE;
+    else if (line == L"[LIBRARIES]")
+      addLines(config,_libraries);
+    else if (line == L"[MODULE_DEFINITION_FILE]")
+      _moduleDefinitionFile=readLine(config);
+    else if (line == L"[MODULE_PREFIX]")
+      _modulePrefix=readLine(config);
+    else if (line == L"[NASM]")
+      _useNasm=true;
+    else if (line == L"[OPTIONAL]")
+      _isOptional=true;
+    else if (line == L"[REFERENCES]")
+      addLines(config,_references);
+    else if (line == L"[RTCD]")
+      addLines(config,_rtcd);
+    else if (line == L"[RTCD_CONFIG]")
+      _rtcdConfig=replace(readLine(config),L"\\",L"/");
+    else if (line == L"[RTCD_SCRIPT]")
+      _rtcdScript=replace(readLine(config),L"\\",L"/");
+    else if (line == L"[SOURCE_ISA]")
+      addLines(config,_sourceIsa);
+    else if (line == L"[TESTS]")
+      addLines(config,_tests);
+    else if (line == L"[TOOLS]")
+      addLines(config,_tools);
+    else if (line == L"[THREADS]")
+      _useThreads=true;
+    else if (line == L"[UNICODE]")
+      _useUnicode=true;
+    else if (line == L"[VISUAL_STUDIO]")
+      _minimumVisualStudioVersion=parseVisualStudioVersion(readLine(config));
+    else if (line == L"[MAGICK_PROJECT]")
+      _magickProject=true;
+    else if (line == L"[LICENSE]")
+      _licenseFileNames=readLicenseFilenames(readLine(config));
+  }
+}
+
+void Project::loadModules(const ConfigureWizard &wizard)
+{
+  HANDLE
+    fileHandle;
+
+  ProjectFile
+    *projectAlias,
+    *projectFile;
+
+  wstring
+    name;
+
+  WIN32_FIND_DATA
+    data;
+
+  foreach (wstring,dir,_directories)
+  {
+    const wstring
+      fileDir(L"../../" + *dir);
+
+    if (!directoryExists(fileDir))
+      throwException(L"Invalid folder specified: " + fileDir);
+
+    fileHandle=FindFirstFile((fileDir + L"/*.*").c_str(),&data);
+    do
+    {
+      if (fileHandle == INVALID_HANDLE_VALUE)
+        return;
+
+      if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == FILE_ATTRIBUTE_DIRECTORY)
+        continue;
+
+      if (contains(_excludes,data.cFileName))
+        continue;
+
+      if (startsWith(data.cFileName,L"main."))
+        continue;
+
+      name=data.cFileName;
+
+      if (!isValidSrcFile(data.cFileName))
+        continue;
+
+      name=name.substr(0,name.find_last_of(L"."));
+      projectFile=new ProjectFile(&wizard,this,_modulePrefix,name);
+      _files.push_back(projectFile);
+
+      foreach(wstring,alias,projectFile->aliases())
+      {
+        projectAlias=new ProjectFile(&wizard,this,_modulePrefix,*alias,name);
+        _files.push_back(projectAlias);
+      }
+
+    } while (FindNextFile(fileHandle,&data));
+  }
+}
+
+vector<wstring> Project::readLicenseFilenames(const wstring &line)
+{
+  wstring
+    fileName;
+
+  vector<wstring>
+    fileNames;
+
+  wstringstream
+    wss(line);
+
+  while(getline(wss, fileName, L';'))
+  {
+    wstring
+      filePath(L"..\\..\\" + name() + L"\\" + fileName);
+
+    filesystem::path
+      file(filePath);
+
+    if (!filesystem::exists(file))
+      throwException(L"Unable to open license file: " + fileName);
+
+    fileNames.push_back(filePath);
+  }
+
+  return (fileNames);
+}
+
+void Project::shardProjectFiles(const ConfigureWizard &wizard)
+{
+  map<wstring,vector<ProjectFile*>>
+    groups;
+
+  ProjectFile
+    *projectFile;
+
+  size_t
+    count,
+    index;
+
+  vector<vector<ProjectFile*>>
+    items;
+
+  vector<ProjectFile*>
+    shards;
+
+  vector<size_t>
+    sizes;
+
+  wstring
+    group;
+
+  /*
+    Modules are grouped by the affinity from the config file (e.g. all the
+    camera formats) or else by the first delegate they depend on. Modules
+    that only use MagickCore can be placed in any shard.
+  */
+  foreach (ProjectFile*,pf,_files)
+  {
+    group=L"";
+    foreach (wstring,affinity,_affinities)
+    {
+      index=(*affinity).find(L":");
+      if (index == wstring::npos)
+        continue;
+
+      wstringstream
+        modules((*affinity).substr(index+1));
+
+      wstring
+        module;
+
+      while (getline(modules,module,L','))
+      {
+        if (trim(module) == (*pf)->moduleName())
+          group=(*affinity).substr(0,index);
+      }
+    }
+    if (group.empty())
+    {
+      foreach (wstring,dep,(*pf)->dependencies())
+      {
+        if (!contains(_dependencies,*dep))
+        {
+          group=*dep;
+          break;
+        }
+      }
+    }
+    if (group.empty())
+      items.push_back(vector<ProjectFile*>(1,*pf));
+    else
+      groups[group].push_back(*pf);
+  }
+  for (auto& g : groups)
+    items.push_back(g.second);
+
+  /* Place the largest groups first, each in the shard with the fewest modules */
+  stable_sort(items.begin(),items.end(),[](const vector<ProjectFile*> &a,const vector<ProjectFile*> &b) { return(a.size() > b.size()); });
+
+  count=min((size_t) wizard.moduleShards(),items.size());
+  for (index=0; index < count; index++)
+  {
+    shards.push_back(new ProjectFile(&wizard,this,_modulePrefix,L"shard" + to_wstring(index+1)));
+    sizes.push_back(0);
+  }
+
+  foreach (vector<ProjectFile*>,item,items)
+  {
+    index=min_element(sizes.begin(),sizes.end())-sizes.begin();
+    foreach (ProjectFile*,pf,(*item))
+    {
+      shards[index]->addModule(*pf);
+    }
+    sizes[index]+=(*item).size();
+  }
+
+  _files=shards;
+}
+
+void Project::setNoticeAndVersion()
+{
+  _notice=L"";
+  foreach(wstring,licenseFileName,_licenseFileNames)
+  {
+    filesystem::path
+      folder,
+      versionFile;
+
+    wifstream
+      version;
+
+    wstring
+      versionFileName;
+
+    folder=filesystem::path(*licenseFileName).parent_path();
+    versionFileName=folder.wstring()+L"\\ImageMagick\\ImageMagick.version.h";
+    versionFile=filesystem::path(versionFileName).wstring();
+    if (!filesystem::exists(versionFile))
+      {
+        folder=folder.parent_path();
+        versionFileName=folder.wstring()+L"\\ImageMagick\\ImageMagick.version.h";
+        versionFile=filesystem::path(versionFileName).wstring();
+        if (!filesystem::exists(versionFile))
+          throwException(L"Unable to find version file for: " + _name);
+      }
+
+    version.open(versionFileName);
+    while (!version.eof())
+    {
+      wstring
+        line;
+
+      line=readLine(version);
+      if (!startsWith(line,L"DELEGATE_VERSION_NUM"))
+        continue;
+
+      line=line.substr(line.find_last_of(L" "));
+      line=replace(line,L",",L".");
+      _versions.push_back(line);
+      break;
+    }
+    version.close();
+
+    _notice+=L"[ "+folder.stem().wstring()+_versions.back()+L" ] copyright:\r\n";
+    _notice+=readLicense(*licenseFileName)+L"\r\n";
+  }
+}
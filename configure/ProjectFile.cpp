@@ -1,815 +1,1503 @@
-/*
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-%                                                                             %
-%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
-%  dedicated to making software imaging solutions freely available.           %
-%                                                                             %
-%  You may not use this file except in compliance with the License.  You may  %
-%  obtain a copy of the License at                                            %
-%                                                                             %
-%    http://www.imagemagick.org/script/license.php                            %
-%                                                                             %
-%  Unless required by applicable law or agreed to in writing, software        %
-%  distributed under the License is distributed on an "AS IS" BASIS,          %
-%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
-%  See the License for the specific language governing permissions and        %
-%  limitations under the License.                                             %
-%                                                                             %
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-*/
-#include "stdafx.h"
-#include "Project.h"
-#include "ProjectFile.h"
-#include "Shared.h"
-#include <algorithm>
-#include <map>
-
-
-static const wstring
-  relativePathForConfigure(L"../../"),
-  relativePathForProject(L"../../../");
-
-ProjectFile::ProjectFile(const ConfigureWizard *wizard,Project *project,
-  const wstring &prefix,const wstring &name)
-  : _wizard(wizard),
-    _project(project),
-    _prefix(prefix),
-    _name(name)
-{
-  initialize(project);
-  loadAliases();
-}
-
-ProjectFile::ProjectFile(const ConfigureWizard *wizard,Project *project,
-  const wstring &prefix,const wstring &name,const wstring &reference)
-  : _wizard(wizard),
-    _project(project),
-    _prefix(prefix),
-    _name(name),
-    _reference(reference)
-{
-  initialize(project);
-}
-
-vector<wstring> &ProjectFile::dependencies()
-{
-  return(_dependencies);
-}
-
-wstring ProjectFile::fileName() const
-{
-  return(_fileName);
-}
-
-wstring ProjectFile::guid() const
-{
-  return(_guid);
-}
-
-wstring ProjectFile::prefix() const
-{
-  return(_prefix);
-}
-
-wstring ProjectFile::name() const
-{
-  return(_prefix+L"_"+_name);
-}
-
-vector<wstring> &ProjectFile::aliases()
-{
-  return(_aliases);
-}
-
-void ProjectFile::initialize(Project* project)
-{
-  _minimumVisualStudioVersion=VSEARLIEST;
-  setFileName();
-  _guid=createGuid();
-
-  foreach(wstring,dep,project->dependencies())
-  {
-    _dependencies.push_back(*dep);
-  }
-
-  foreach(wstring,inc,project->includes())
-  {
-    _includes.push_back(*inc);
-  }
-
-  foreach(wstring,inc,project->definesLib())
-  {
-    _definesLib.push_back(*inc);
-  }
-}
-
-bool ProjectFile::isSrcFile(const wstring &fileName)
-{
-  if (endsWith(fileName,L".asm"))
-    return(true);
-
-  return(isValidSrcFile(fileName));
-}
-
-bool ProjectFile::isExcluded(const wstring &fileName)
-{
-  if (contains(_project->excludes(),fileName))
-    return true;
-
-  if (contains(_project->platformExcludes(_wizard->platform()),fileName))
-    return true;
-
-  if (endsWith(fileName,L".h"))
-    return isExcluded(replace(fileName,L".h",L".c")) || isExcluded(replace(fileName,L".h",L".cc"));
-
-  return false;
-}
-
-void ProjectFile::loadAliases()
-{
-  wifstream
-    aliases;
-
-  wstring
-    fileName,
-    line;
-
-  if (!_project->isExe() || !_project->isModule())
-    return;
-
-  fileName=L"..\\" + _project->name() + L"\\Aliases." + _name + L".txt";
-
-  aliases.open(fileName);
-  if (!aliases)
-    return;
-
-  while (!aliases.eof())
-  {
-    line=readLine(aliases);
-    if (!line.empty())
-      _aliases.push_back(line);
-  }
-
-  aliases.close();
-}
-
-bool ProjectFile::isSupported(const VisualStudioVersion visualStudioVersion) const
-{
-  return(visualStudioVersion >= _minimumVisualStudioVersion);
-}
-
-void ProjectFile::loadConfig()
-{
-  wifstream
-    config;
-
-  wstring
-    fileName,
-    line;
-
-  if (!_project->isModule())
-    return;
-
-  fileName=L"..\\" + _project->name() + L"\\Config." + _name + L".txt";
-
-  config.open(fileName);
-  if (!config)
-    return;
-
-  while (!config.eof())
-  {
-    line=readLine(config);
-    if (line == L"[DEPENDENCIES]")
-      addLines(config,_dependencies);
-    else if (line == L"[INCLUDES]")
-      addLines(config,_includes);
-    else if (line == L"[CPP]")
-      addLines(config,_cppFiles);
-    else if (line == L"[VISUAL_STUDIO]")
-      _minimumVisualStudioVersion=parseVisualStudioVersion(readLine(config));
-    else if (line == L"[DEFINES_LIB]")
-      addLines(config,_definesLib);
-  }
-
-  config.close();
-}
-
-void ProjectFile::merge(ProjectFile *projectFile)
-{
-  merge(projectFile->_dependencies,_dependencies);
-  merge(projectFile->_includes,_includes);
-  merge(projectFile->_cppFiles,_cppFiles);
-  merge(projectFile->_definesLib,_definesLib);
-}
-
-void ProjectFile::write(const vector<Project*> &allprojects)
-{
-  wofstream
-    file;
-
-  wstring
-    projectDir(L"..\\VisualStudioProjects\\" + name());
-
-  CreateDirectoryW(projectDir.c_str(), NULL);
-
-  file.open(projectDir + L"\\" + _fileName);
-  if (!file)
-    return;
-
-  loadSource();
-
-  write(file,allprojects);
-
-  if (_project->isExe() && _project->icon() != L"")
-  {
-    file.close();
-
-    file.open(projectDir + L"\\" + name() + L".rc");
-    if (!file)
-      return;
-
-    file << "#define IDI_ICON1 101" << endl;
-    file << "IDI_ICON1 ICON \"" << relativePathForProject <<  _project->icon() << "\"" << endl;
-  }
-
-  file.close();
-}
-
-bool ProjectFile::isLib() const
-{
-  return(_project->isLib() || (_wizard->solutionType() != SolutionType::DYNAMIC_MT && _project->isDll()));
-}
-
-wstring ProjectFile::outputDirectory() const
-{
-  if (_project->isFuzz())
-    return(_wizard->fuzzBinDirectory());
-
-  if (isLib())
-    return(_wizard->libDirectory());
-
-  return(_wizard->binDirectory());
-}
-
-void ProjectFile::addFile(const wstring &directory, const wstring &name)
-{
-  wstring
-    header_file,
-    src_file;
-
-  foreach_const(wstring,ext,validSrcFiles)
-  {
-    src_file=directory + L"/" + name + *ext;
-
-    if (PathFileExists((relativePathForConfigure + src_file).c_str()))
-    {
-      _srcFiles.push_back(relativePathForProject + src_file);
-
-      header_file=directory + L"/" + name + L".h";
-      if (PathFileExists((relativePathForConfigure + header_file).c_str()))
-        _includeFiles.push_back(relativePathForProject + header_file);
-
-      break;
-    }
-  }
-
-  if (!_project->isExe())
-    return;
-
-  foreach_const(wstring,ext,validSrcFiles)
-  {
-    src_file=directory + L"/main" + *ext;
-
-    if (PathFileExists((relativePathForConfigure + src_file).c_str()))
-    {
-      _srcFiles.push_back(relativePathForProject + src_file);
-
-      header_file=directory + L"/" + name + L".h";
-      if (PathFileExists((relativePathForConfigure + header_file).c_str()))
-        _includeFiles.push_back(relativePathForProject + header_file);
-
-      break;
-    }
-  }
-}
-
-void ProjectFile::addLines(wifstream &config,vector<wstring> &container)
-{
-  wstring
-    line;
-
-  while (!config.eof())
-  {
-    line=readLine(config);
-    if (line.empty())
-      return;
-
-    std::replace(line.begin(), line.end(), L'\\', L'/');
-
-    if (!contains(container,line))
-      container.push_back(line);
-  }
-}
-
-wstring ProjectFile::asmOptions()
-{
-  switch (_wizard->platform())
-  {
-    case Platform::X86: return(L"ml /nologo /c /Cx /safeseh /coff /Fo\"$(IntDir)%(Filename).obj\" \"%(FullPath)\"");
-    case Platform::X64: return(L"ml64 /nologo /c /Cx /Fo\"$(IntDir)%(Filename).obj\" \"%(FullPath)\"");
-    case Platform::ARM64: return(L"armasm64 \"%(FullPath)\" -o \"$(IntDir)%(Filename).obj\"");
-    default: throw;
-  }
-}
-
-wstring ProjectFile::getFilter(const wstring &fileName,vector<wstring> &filters)
-{
-  wstring
-    filter,
-    folder;
-
-  filter=replace(fileName,L"..\\",L"");
-  if (filter.find_first_of(L"\\") == filter.find_last_of(L"\\"))
-    return L"";
-
-  filter=filter.substr(filter.find_first_of(L"\\") + 1);
-
-  folder=filter;
-  while (folder.find_first_of(L"\\") != -1)
-  {
-    folder=folder.substr(0, folder.find_last_of(L"\\"));
-    if (!contains(filters,folder))
-      filters.push_back(folder);
-  }
-
-  filter=filter.substr(0, filter.find_last_of(L"\\"));
-
-  return filter;
-}
-
-wstring ProjectFile::getIntermediateDirectoryName(const bool debug)
-{
-  wstring
-    directoryName;
-
-  directoryName = (debug ? L"Debug\\" : L"Release\\");
-  directoryName += _wizard->solutionName() + L"-" + _wizard->platformName() + L"\\";
-  directoryName += _prefix + L"_" + _name + L"\\";
-  return(directoryName);
-}
-
-wstring ProjectFile::getTargetName(const bool debug)
-{
-  wstring
-    targetName;
-
-  targetName=_prefix+L"_";
-  if (_prefix.compare(L"FILTER") != 0)
-    targetName+=wstring(debug ? L"DB" : L"RL")+L"_";
-  targetName+=_name+L"_";
-  return(targetName);
-}
-
-void ProjectFile::loadModule(const wstring &directory)
-{
-  if (!_reference.empty())
-    addFile(directory, _reference);
-  else
-    addFile(directory, _name);
-}
-
-void ProjectFile::loadSource()
-{
-  wstring
-    resourceFile;
-
-  foreach (wstring,dir,_project->directories())
-  {
-    if ((_project->isModule()) && (_project->isExe() || (_project->isDll() && _wizard->solutionType() == SolutionType::DYNAMIC_MT)))
-      loadModule(*dir);
-    else
-      loadSource(*dir);
-  }
-
-  resourceFile=relativePathForProject + _project->name() + L"\\ImageMagick\\ImageMagick.rc";
-  if (PathFileExists(resourceFile.c_str()))
-    _resourceFiles.push_back(resourceFile);
-
-  /* This resource file is used by the ImageMagick projects */
-  resourceFile=relativePathForProject + _project->name() + L"\\ImageMagick.rc";
-  if (PathFileExists(resourceFile.c_str()))
-    _resourceFiles.push_back(resourceFile);
-}
-
-void ProjectFile::loadSource(const wstring &directory)
-{
-  HANDLE
-    fileHandle;
-
-  WIN32_FIND_DATA
-    data;
-
-  if (contains(_project->platformExcludes(_wizard->platform()),directory))
-    return;
-
-  fileHandle=FindFirstFile((relativePathForConfigure + directory + L"\\*.*").c_str(),&data);
-  do
-  {
-    if (fileHandle == INVALID_HANDLE_VALUE)
-      return;
-
-    if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == FILE_ATTRIBUTE_DIRECTORY)
-      continue;
-
-    if (isExcluded(data.cFileName))
-      continue;
-
-    if (isSrcFile(data.cFileName))
-      _srcFiles.push_back(relativePathForProject + directory + L"/" + data.cFileName);
-    else if (endsWith(data.cFileName,L".h"))
-      _includeFiles.push_back(relativePathForProject + directory + L"/" + data.cFileName);
-    else if (endsWith(data.cFileName,L".rc"))
-      _resourceFiles.push_back(relativePathForProject + directory + L"/" + data.cFileName);
-
-  } while (FindNextFile(fileHandle,&data));
-
-  FindClose(fileHandle);
-}
-
-wstring ProjectFile::nasmOptions(const wstring &folder)
-{
-  wstring
-    result=L"";
-
-  if (_wizard->platform() == Platform::ARM64)
-    return(result);
-
-  result += L"..\\build\\nasm -i\"" + folder +L"\"";
-
-  if (_wizard->platform() == Platform::X86)
-    result += L" -fwin32 -DWIN32";
-  else
-    result += L" -fwin64 -DWIN64 -D__x86_64__";
-
-  foreach_const(wstring,include,_project->includesNasm())
-    result += L" -i\"" + relativePathForProject + *include + L"\"";
-
-  result += L" -o \"$(IntDir)%(Filename).obj\" \"%(FullPath)\"";
-  return(result);
-}
-
-void ProjectFile::merge(vector<wstring> &input, vector<wstring> &output)
-{
-  foreach (wstring,value,input)
-  {
-    if (!contains(output,*value))
-      output.push_back(*value);
-  }
-}
-
-void ProjectFile::setFileName()
-{
-  _fileName = L"CMakeLists.txt";
-}
-
-wstring ProjectFile::createGuid()
-{
-  GUID
-    guid;
-
-  RPC_WSTR
-    guidStr;
-
-  wstring
-    result;
-
-  (void) CoCreateGuid(&guid);
-  (void) UuidToString(&guid,&guidStr);
-  result=wstring((wchar_t *) guidStr);
-  transform(result.begin(),result.end(),result.begin(),::toupper);
-  RpcStringFree(&guidStr);
-  return result;
-}
-
-void ProjectFile::write(wofstream &file,const vector<Project*> &allProjects)
-{
-  writeHeader(file);
-
-  writeTarget(file);
-
-  writeIncludeDirectories(file);
-
-  writeCompileDefinitions(file);
-
-  writeCompileOptions(file);
-
-  writeProperties(file);
-
-  writeFiles(file,_srcFiles);
-  writeFiles(file,_includeFiles);
-  writeFiles(file,_resourceFiles);
-  writeIcon(file);
-
-  writeProjectReferences(file,allProjects);
-}
-
-void ProjectFile::writeHeader(wofstream& file)
-{
-  file << "cmake_minimum_required(VERSION " << _wizard->cmakeMinVersion() << ")" << endl;
-  file << "project(" << name() << " LANGUAGES C CXX ASM" << ")" << endl;
-
-  file << "set(CMAKE_CXX_STANDARD 17)" << endl;
-  file << "set(CMAKE_CXX_STANDARD_REQUIRED ON)" << endl;
-
-  file << "set(CMAKE_C_STANDARD 17)" << endl;
-  file << "set(CMAKE_C_STANDARD_REQUIRED ON)" << endl;
-
-  if (_project->useUnicode())
-  {
-    file << "add_definitions(-UNICODE -D_UNICODE)" << endl;
-  }
-}
-
-void ProjectFile::writeTarget(wofstream& file)
-{
-  if (isLib())
-  {
-    file << "add_library(" << name() << " STATIC" << ")" << endl;
-  }
-  else if (_project->isDll())
-  {
-    file << "add_library(" << name() << " SHARED" << ")" << endl;
-  }
-  else if (_project->isExe())
-  {
-    file << "add_executable(" << name() << ")" << endl;
-  }
-}
-
-void ProjectFile::writeIncludeDirectories(wostream& file)
-{
-  file << "target_include_directories(" << name() << " PUBLIC ";
-  for (wstring projectDir : _project->directories())
-  {
-    bool skip = false;
-
-    for (wstring includeDir : _includes)
-    {
-      if (projectDir.find(includeDir) == 0)
-      {
-        skip = true;
-        break;
-      }
-    }
-
-    if (!skip)
-    {
-      file << "\n" << "  " << relativePathForProject << projectDir;
-    }
-  }
-
-  for (wstring includeDir : _includes)
-  {
-    file << "\n" << "  " << relativePathForProject << includeDir;
-  }
-
-  if (_wizard->useOpenCL())
-  {
-    file << "\n" << "  " << relativePathForProject << L"VisualMagick/OpenCL";
-  }
-  file << "\n)" << endl;
-}
-
-void ProjectFile::writeCompileDefinitions(wostream& file)
-{
-  file << "target_compile_definitions(" << name() << " PRIVATE ";
-  file << "\n" << "  $<$<CONFIG:Debug>:_DEBUG>";
-  file << "\n" << "  $<$<CONFIG:Release>:NDEBUG>";
-  file << "\n" << "  _WINDOWS";
-  file << "\n" << "  WIN32";
-  file << "\n" << "  _VISUALC_";
-  file << "\n" << "  NeedFunctionPrototypes";
-
-  for (wstring def : _project->defines())
-  {
-    file << "\n" << "  " << def;
-  }
-
-  if (isLib() || (_wizard->solutionType() != SolutionType::DYNAMIC_MT && (_project->isExe())))
-  {
-    for (wstring def : _definesLib)
-    {
-      file << "\n" << "  " << def;
-    }
-    file << "\n" << "  _LIB";
-  }
-  else if (_project->isDll())
-  {
-    for (wstring def : _project->definesDll())
-    {
-      file << "\n" << "  " << def;
-    }
-    file << "\n" << "  _DLL";
-    file << "\n" << "  _MAGICKMOD_";
-  }
-
-  if (_project->isExe() && _wizard->solutionType() != SolutionType::STATIC_MT)
-  {
-    file << "\n" << "  _AFXDLL";
-  }
-  if (_wizard->includeIncompatibleLicense())
-  {
-    file << "\n" << "  _MAGICK_INCOMPATIBLE_LICENSES_";
-  }
-  file << "\n)" << endl;
-}
-
-void ProjectFile::writeCompileOptions(wostream& file)
-{
-  file << "target_compile_options(" << name() << " PRIVATE /W" << _project->warningLevel();
-  if (_project->treatWarningAsError())
-  {
-    file << " /WX";
-  }
-  if (_project->compiler(_wizard->visualStudioVersion()) == Compiler::CPP)
-  {
-    file << " /TP";
-  }
-  file << " /Zi";
-  if (_wizard->useOpenMP())
-  {
-    file << " /openmp";
-  }
-  file << " /FC";
-  file << " /source-charset:utf-8";
-  file << ")" << endl;
-}
-
-void ProjectFile::writeProperties(wostream& file)
-{
-  if (_project->isFuzz())
-  {
-    file << "set_target_properties(" << name() << " PROPERTIES " << endl;
-    file << "  RUNTIME_OUTPUT_DIRECTORY " << _wizard->fuzzBinDirectory() << endl;
-    file << ")" << endl;
-  }
-}
-
-void ProjectFile::writeAdditionalDependencies(wofstream &file,const wstring &separator)
-{
-  foreach (wstring,lib,_project->libraries())
-  {
-    file << separator << *lib;
-  }
-}
-
-void ProjectFile::writeAdditionalIncludeDirectories(wofstream &file,const wstring &separator)
-{
-  foreach (wstring,projectDir,_project->directories())
-  {
-    bool
-      skip;
-
-    skip=false;
-    foreach (wstring,includeDir,_includes)
-    {
-      if ((*projectDir).find(*includeDir) == 0)
-      {
-        skip=true;
-        break;
-      }
-    }
-
-    if (!skip)
-      file << separator << relativePathForProject <<  *projectDir;
-  }
-  foreach (wstring,includeDir,_includes)
-  {
-    file << separator << relativePathForProject << *includeDir;
-  }
-  if (_wizard->useOpenCL())
-    file << separator << relativePathForProject << L"VisualMagick/OpenCL";
-}
-
-void ProjectFile::writeIcon(wofstream &file)
-{
-  if (!_project->isExe() || _project->icon() == L"")
-    return;
-
-  file << "target_sources(" << name() << " PRIVATE" << endl;
-  file << "  " << name() << ".rc" << endl;
-  file << ")" << endl;
-}
-
-void ProjectFile::writeFiles(wofstream &file,const vector<wstring> &collection)
-{
-  int
-    count;
-
-  map<wstring, int>
-    fileCount;
-
-  wstring
-    fileName,
-    folder,
-    name;
-
-  if (collection.size() == 0)
-    return;
-
-  file << "target_sources(" << this->name() << " PRIVATE" << endl;
-  for (const wstring& f : collection)
-  {
-    file << "  " << f << endl;
-  }
-  file << ")" << endl;
-
-  for (const wstring& f : collection)
-  {
-    if (!endsWith(f, L".asm") && !endsWith(f, L".rc") && !endsWith(f, L".h"))
-    {
-      if (_project->compiler(_wizard->visualStudioVersion()) == Compiler::CPP)
-      {
-        file << "set_source_files_properties(" << f << " PROPERTIES LANGUAGE CXX)" << endl;
-      }
-    }
-  }
-}
-
-void ProjectFile::writePreprocessorDefinitions(wofstream &file,const bool debug)
-{
-  file << (debug ? "_DEBUG" : "NDEBUG") << ";_WINDOWS;WIN32;_VISUALC_;NeedFunctionPrototypes";
-  foreach (wstring,def,_project->defines())
-  {
-    file << ";" << *def;
-  }
-  if (isLib() || (_wizard->solutionType() != SolutionType::DYNAMIC_MT && (_project->isExe())))
-  {
-    foreach (wstring,def,_definesLib)
-    {
-      file << ";" << *def;
-    }
-    file << ";_LIB";
-  }
-  else if (_project->isDll())
-  {
-    foreach (wstring,def,_project->definesDll())
-    {
-      file << ";" << *def;
-    }
-    file << ";_DLL;_MAGICKMOD_";
-  }
-  if (_project->isExe() && _wizard->solutionType() != SolutionType::STATIC_MT)
-    file << ";_AFXDLL";
-  if (_wizard->includeIncompatibleLicense())
-    file << ";_MAGICK_INCOMPATIBLE_LICENSES_";
-}
-
-void ProjectFile::writeProjectReferences(wofstream &file,const vector<Project*> &allProjects)
-{
-  size_t
-    index;
-
-  wstring
-    projectName,
-    projectFileName;
-
-  bool hasDep = false;
-
-  for (const wstring& dep : _dependencies)
-  {
-    projectName = dep;
-    projectFileName = L"";
-    index = dep.find(L">");
-    if (index != -1)
-    {
-      projectName = dep.substr(0, index);
-      projectFileName = dep.substr(index + 1);
-    }
-
-    for (const auto& depp : allProjects)
-    {
-      if (depp->name() != projectName)
-        continue;
-
-      for (const auto& deppf : depp->files())
-      {
-        if (projectFileName != L"" && deppf->_name != projectFileName)
-          continue;
-
-        if (!hasDep)
-        {
-          hasDep = true;
-          file << "target_link_libraries(" << name() << " PUBLIC " << endl;
-        }
-
-        file << "  " << deppf->name() << endl;
-      }
-    }
-  }
-
-  if (hasDep)
-  {
-    file << ")" << endl;
-  }
-}
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "stdafx.h"
+#include "Project.h"
+#include "ProjectFile.h"
+#include "Shared.h"
+#include <algorithm>
+#include <map>
+#include <set>
+
+
+static const wstring
+  relativePathForConfigure(L"../../"),
+  relativePathForResource(L"../../../");
+
+ProjectFile::ProjectFile(const ConfigureWizard *wizard,Project *project,
+  const wstring &prefix,const wstring &name)
+  : _wizard(wizard),
+    _project(project),
+    _prefix(prefix),
+    _name(name)
+{
+  initialize(project);
+  loadAliases();
+}
+
+ProjectFile::ProjectFile(const ConfigureWizard *wizard,Project *project,
+  const wstring &prefix,const wstring &name,const wstring &reference)
+  : _wizard(wizard),
+    _project(project),
+    _prefix(prefix),
+    _name(name),
+    _reference(reference)
+{
+  initialize(project);
+}
+
+void ProjectFile::absorb(const ProjectFile *projectFile)
+{
+  _absorbed.push_back(projectFile->name());
+}
+
+vector<wstring> &ProjectFile::dependencies()
+{
+  return(_dependencies);
+}
+
+vector<ProjectFile*> ProjectFile::dependencyFiles(const vector<Project*> &allProjects)
+{
+  size_t
+    index;
+
+  vector<ProjectFile*>
+    result;
+
+  wstring
+    projectName,
+    projectFileName;
+
+  for (const wstring& dep : _dependencies)
+  {
+    projectName = dep;
+    projectFileName = L"";
+    index = dep.find(L">");
+    if (index != -1)
+    {
+      projectName = dep.substr(0, index);
+      projectFileName = dep.substr(index + 1);
+    }
+
+    for (const auto& depp : allProjects)
+    {
+      if (depp->name() != projectName)
+        continue;
+
+      for (const auto& deppf : depp->files())
+      {
+        if (isDependency(projectFileName,deppf))
+          result.push_back(deppf);
+      }
+    }
+  }
+
+  return(result);
+}
+
+wstring ProjectFile::fileName() const
+{
+  return(_fileName);
+}
+
+unsigned long long ProjectFile::fingerprint(unsigned long long hash) const
+{
+  wstring
+    fileName;
+
+  hash=fnv1a(hash,name());
+  /* The project is written before the fingerprint is created */
+  hash=fnv1aFile(hash,L"..\\VisualStudioProjects\\" + name() + L"\\" + _fileName);
+  for (const wstring& f : _srcFiles)
+  {
+    fileName=relativePathForConfigure + f.substr(relativePathForProject().length());
+    hash=fnv1a(hash,f);
+    hash=fnv1aFile(hash,fileName);
+  }
+  for (const wstring& f : _includeFiles)
+  {
+    fileName=relativePathForConfigure + f.substr(relativePathForProject().length());
+    hash=fnv1a(hash,f);
+    hash=fnv1aFile(hash,fileName);
+  }
+  return(hash);
+}
+
+wstring ProjectFile::guid() const
+{
+  return(_guid);
+}
+
+bool ProjectFile::isExported() const
+{
+  /* The delegates are installed as a package that is used by the ImageMagick projects */
+  return(_wizard->delegateSdk() && !_project->isMagickProject());
+}
+
+wstring ProjectFile::isa() const
+{
+  return(_isa);
+}
+
+void ProjectFile::isa(const wstring &value)
+{
+  _isa=value;
+  setFileName();
+}
+
+bool ProjectFile::isFormat(const wstring &format) const
+{
+  if (toLower(_name) == format)
+    return(true);
+
+  foreach_const (wstring,f,_formats)
+  {
+    if (toLower(*f) == format)
+      return(true);
+  }
+
+  return(false);
+}
+
+wstring ProjectFile::jobPoolLink() const
+{
+  return(_jobPoolLink);
+}
+
+void ProjectFile::jobPoolLink(const wstring &value)
+{
+  _jobPoolLink=value;
+}
+
+wstring ProjectFile::moduleName() const
+{
+  return(_name);
+}
+
+vector<wstring> &ProjectFile::modules()
+{
+  return(_modules);
+}
+
+size_t ProjectFile::objectCount() const
+{
+  return(_srcFiles.size());
+}
+
+wstring ProjectFile::variant() const
+{
+  return(_variant);
+}
+
+void ProjectFile::variant(const wstring &value)
+{
+  _variant=value;
+  setFileName();
+}
+
+wstring ProjectFile::prefix() const
+{
+  return(_prefix);
+}
+
+wstring ProjectFile::name() const
+{
+  wstring
+    name;
+
+  name=_prefix+L"_"+_name;
+  if (!_variant.empty())
+    name+=L"_"+_variant;
+  if (!_isa.empty())
+    name+=L"_"+_isa;
+  return(name);
+}
+
+vector<wstring> &ProjectFile::aliases()
+{
+  return(_aliases);
+}
+
+vector<wstring> &ProjectFile::formats()
+{
+  return(_formats);
+}
+
+void ProjectFile::initialize(Project* project)
+{
+  _minimumVisualStudioVersion=VSEARLIEST;
+  setFileName();
+  _guid=createGuid();
+
+  foreach(wstring,dep,project->dependencies())
+  {
+    _dependencies.push_back(*dep);
+  }
+
+  foreach(wstring,inc,project->includes())
+  {
+    _includes.push_back(*inc);
+  }
+
+  merge(project->dependenciesInterface(),_dependenciesInterface);
+  merge(project->dependenciesPrivate(),_dependenciesPrivate);
+  merge(project->includesInterface(),_includesInterface);
+  merge(project->includesPrivate(),_includesPrivate);
+
+  foreach(wstring,inc,project->definesLib())
+  {
+    _definesLib.push_back(*inc);
+  }
+}
+
+bool ProjectFile::isFlat() const
+{
+  /* The delegates stage has its own root and cannot include the fragments */
+  return(_wizard->flatCMake() && !isExported());
+}
+
+bool ProjectFile::isSrcFile(const wstring &fileName)
+{
+  if (endsWith(fileName,L".asm"))
+    return(true);
+
+  /* The GNU assembly files are only used when they are listed as not supported by MSVC */
+  if (endsWith(fileName,L".S"))
+    return(contains(_project->excludesMsvc(),fileName));
+
+  return(isValidSrcFile(fileName));
+}
+
+bool ProjectFile::isDependency(const wstring &projectFileName,const ProjectFile *projectFile) const
+{
+  if (projectFileName != L"" && projectFile->_name != projectFileName && !contains(projectFile->_modules,projectFileName))
+    return(false);
+
+  if (!projectFile->_variant.empty() && projectFile->_variant != _variant)
+    return(false);
+
+  if (!projectFile->_isa.empty() && projectFile->_isa != _isa)
+    return(false);
+
+  /* The referenced module can be part of the same shard */
+  return(projectFile != this);
+}
+
+bool ProjectFile::isExcluded(const wstring &fileName)
+{
+  if (contains(_project->excludes(),fileName))
+    return true;
+
+  if (contains(_project->platformExcludes(_wizard->platform()),fileName))
+    return true;
+
+  if (endsWith(fileName,L".h"))
+    return isExcluded(replace(fileName,L".h",L".c")) || isExcluded(replace(fileName,L".h",L".cc"));
+
+  return false;
+}
+
+void ProjectFile::loadAliases()
+{
+  wifstream
+    aliases;
+
+  wstring
+    fileName,
+    line;
+
+  if (!_project->isExe() || !_project->isModule())
+    return;
+
+  fileName=L"..\\" + _project->name() + L"\\Aliases." + _name + L".txt";
+
+  aliases.open(fileName);
+  if (!aliases)
+    return;
+
+  while (!aliases.eof())
+  {
+    line=readLine(aliases);
+    if (!line.empty())
+      _aliases.push_back(line);
+  }
+
+  aliases.close();
+}
+
+bool ProjectFile::isSupported(const VisualStudioVersion visualStudioVersion) const
+{
+  return(visualStudioVersion >= _minimumVisualStudioVersion);
+}
+
+void ProjectFile::loadConfig()
+{
+  wifstream
+    config;
+
+  wstring
+    fileName,
+    line;
+
+  if (!_project->isModule())
+    return;
+
+  fileName=L"..\\" + _project->name() + L"\\Config." + _name + L".txt";
+
+  config.open(fileName);
+  if (!config)
+    return;
+
+  while (!config.eof())
+  {
+    line=readLine(config);
+    if (line == L"[DEPENDENCIES]")
+      addLines(config,_dependencies);
+    else if (line == L"[DEPENDENCIES_INTERFACE]")
+      addScopedLines(config,_dependencies,_dependenciesInterface);
+    else if (line == L"[DEPENDENCIES_PRIVATE]")
+      addScopedLines(config,_dependencies,_dependenciesPrivate);
+    else if (line == L"[INCLUDES]")
+      addLines(config,_includes);
+    else if (line == L"[INCLUDES_INTERFACE]")
+      addScopedLines(config,_includes,_includesInterface);
+    else if (line == L"[INCLUDES_PRIVATE]")
+      addScopedLines(config,_includes,_includesPrivate);
+    else if (line == L"[CPP]")
+      addLines(config,_cppFiles);
+    else if (line == L"[FORMATS]")
+      addLines(config,_formats);
+    else if (line == L"[VISUAL_STUDIO]")
+      _minimumVisualStudioVersion=parseVisualStudioVersion(readLine(config));
+    else if (line == L"[DEFINES_LIB]")
+      addLines(config,_definesLib);
+  }
+
+  config.close();
+}
+
+void ProjectFile::merge(ProjectFile *projectFile)
+{
+  merge(projectFile->_dependencies,_dependencies);
+  merge(projectFile->_dependenciesInterface,_dependenciesInterface);
+  merge(projectFile->_dependenciesPrivate,_dependenciesPrivate);
+  merge(projectFile->_includes,_includes);
+  merge(projectFile->_includesInterface,_includesInterface);
+  merge(projectFile->_includesPrivate,_includesPrivate);
+  merge(projectFile->_cppFiles,_cppFiles);
+  merge(projectFile->_definesLib,_definesLib);
+}
+
+void ProjectFile::addModule(ProjectFile *projectFile)
+{
+  merge(projectFile);
+  _modules.push_back(projectFile->_name);
+}
+
+void ProjectFile::write(const vector<Project*> &allprojects)
+{
+  wofstream
+    file;
+
+  wstring
+    projectDir(L"..\\VisualStudioProjects\\" + name());
+
+  CreateDirectoryW(projectDir.c_str(), NULL);
+
+  file.open(projectDir + L"\\" + _fileName);
+  if (!file)
+    return;
+
+  write(file,allprojects);
+
+  if (_project->isExe() && _project->icon() != L"" && !_wizard->targetLinux())
+  {
+    file.close();
+
+    file.open(projectDir + L"\\" + name() + L".rc");
+    if (!file)
+      return;
+
+    file << "#define IDI_ICON1 101" << endl;
+    file << "IDI_ICON1 ICON \"" << relativePathForResource <<  _project->icon() << "\"" << endl;
+  }
+
+  file.close();
+}
+
+bool ProjectFile::isLib() const
+{
+  return(_project->isLib() || (_wizard->solutionType() != SolutionType::DYNAMIC_MT && _project->isDll()));
+}
+
+bool ProjectFile::useNasm() const
+{
+  /* The ARM64 build uses the intrinsics instead of the assembly kernels */
+  return(_project->useNasm() && _wizard->platform() != Platform::ARM64);
+}
+
+bool ProjectFile::isObjectLibrary() const
+{
+  /* The objects of a static delegate are linked into the target that absorbs it, every DLL would need its own copy */
+  if (!_wizard->objectLibraries() || _wizard->solutionType() == SolutionType::DYNAMIC_MT)
+    return(false);
+
+  return(isLib() && !_project->isMagickProject() && !isExported());
+}
+
+wstring ProjectFile::outputDirectory() const
+{
+  if (_project->isFuzz())
+    return(_wizard->fuzzBinDirectory());
+
+  if (isLib())
+    return(_wizard->libDirectory());
+
+  return(_wizard->binDirectory());
+}
+
+void ProjectFile::addFile(const wstring &directory, const wstring &name)
+{
+  wstring
+    header_file,
+    src_file;
+
+  foreach_const(wstring,ext,validSrcFiles)
+  {
+    src_file=directory + L"/" + name + *ext;
+
+    if (PathFileExists((relativePathForConfigure + src_file).c_str()))
+    {
+      _srcFiles.push_back(relativePathForProject() + src_file);
+
+      header_file=directory + L"/" + name + L".h";
+      if (PathFileExists((relativePathForConfigure + header_file).c_str()))
+        _includeFiles.push_back(relativePathForProject() + header_file);
+
+      break;
+    }
+  }
+
+  if (!_project->isExe())
+    return;
+
+  foreach_const(wstring,ext,validSrcFiles)
+  {
+    src_file=directory + L"/main" + *ext;
+
+    if (PathFileExists((relativePathForConfigure + src_file).c_str()))
+    {
+      _srcFiles.push_back(relativePathForProject() + src_file);
+
+      header_file=directory + L"/" + name + L".h";
+      if (PathFileExists((relativePathForConfigure + header_file).c_str()))
+        _includeFiles.push_back(relativePathForProject() + header_file);
+
+      break;
+    }
+  }
+}
+
+void ProjectFile::addLines(wifstream &config,vector<wstring> &container)
+{
+  wstring
+    line;
+
+  while (!config.eof())
+  {
+    line=readLine(config);
+    if (line.empty())
+      return;
+
+    std::replace(line.begin(), line.end(), L'\\', L'/');
+
+    if (!contains(container,line))
+      container.push_back(line);
+  }
+}
+
+void ProjectFile::addResourceFile(const wstring &fileName)
+{
+  /* The existence is checked from the configure directory and the file is used from the project */
+  if (PathFileExists((relativePathForConfigure + fileName).c_str()))
+    _resourceFiles.push_back(relativePathForProject() + fileName);
+}
+
+wstring ProjectFile::asmOptions()
+{
+  switch (_wizard->platform())
+  {
+    case Platform::X86: return(L"ml /nologo /c /Cx /safeseh /coff /Fo\"$(IntDir)%(Filename).obj\" \"%(FullPath)\"");
+    case Platform::X64: return(L"ml64 /nologo /c /Cx /Fo\"$(IntDir)%(Filename).obj\" \"%(FullPath)\"");
+    case Platform::ARM64: return(L"armasm64 \"%(FullPath)\" -o \"$(IntDir)%(Filename).obj\"");
+    default: throw;
+  }
+}
+
+wstring ProjectFile::excludeMsvc(const wstring &value,const wstring &name) const
+{
+  if (!contains(_project->excludesMsvc(),name) && !contains(_project->excludesMsvc(),sourcePath(value)))
+    return(value);
+
+  return(L"$<$<NOT:$<STREQUAL:${MAGICK_TOOLCHAIN}," + toolchainName(Toolchain::MSVC) + L">>:" + value + L">");
+}
+
+wstring ProjectFile::getFilter(const wstring &fileName,vector<wstring> &filters)
+{
+  wstring
+    filter,
+    folder;
+
+  filter=replace(fileName,L"..\\",L"");
+  if (filter.find_first_of(L"\\") == filter.find_last_of(L"\\"))
+    return L"";
+
+  filter=filter.substr(filter.find_first_of(L"\\") + 1);
+
+  folder=filter;
+  while (folder.find_first_of(L"\\") != -1)
+  {
+    folder=folder.substr(0, folder.find_last_of(L"\\"));
+    if (!contains(filters,folder))
+      filters.push_back(folder);
+  }
+
+  filter=filter.substr(0, filter.find_last_of(L"\\"));
+
+  return filter;
+}
+
+wstring ProjectFile::getIntermediateDirectoryName(const bool debug)
+{
+  wstring
+    directoryName;
+
+  directoryName = (debug ? L"Debug\\" : L"Release\\");
+  directoryName += _wizard->solutionName() + L"-" + _wizard->platformName() + L"\\";
+  directoryName += _prefix + L"_" + _name + L"\\";
+  return(directoryName);
+}
+
+wstring ProjectFile::getTargetName(const bool debug)
+{
+  wstring
+    targetName;
+
+  targetName=_prefix+L"_";
+  if (_prefix.compare(L"FILTER") != 0)
+    targetName+=wstring(debug ? L"DB" : L"RL")+L"_";
+  targetName+=_name+L"_";
+  return(targetName);
+}
+
+void ProjectFile::loadModule(const wstring &directory)
+{
+  if (!_modules.empty())
+  {
+    foreach (wstring,module,_modules)
+    {
+      addFile(directory, *module);
+    }
+  }
+  else if (!_reference.empty())
+    addFile(directory, _reference);
+  else
+    addFile(directory, _name);
+}
+
+void ProjectFile::loadSource()
+{
+  wstring
+    resourceFile;
+
+  foreach (wstring,dir,_project->directories())
+  {
+    if ((_project->isModule()) && (_project->isExe() || (_project->isDll() && _wizard->solutionType() == SolutionType::DYNAMIC_MT)))
+      loadModule(*dir);
+    else
+      loadSource(*dir);
+  }
+
+  if (_wizard->targetLinux())
+    return;
+
+  addResourceFile(L"VisualMagick/" + _project->name() + L"/ImageMagick/ImageMagick.rc");
+
+  /* This resource file is used by the ImageMagick projects */
+  addResourceFile(L"VisualMagick/" + _project->name() + L"/ImageMagick.rc");
+}
+
+void ProjectFile::loadSource(const wstring &directory)
+{
+  HANDLE
+    fileHandle;
+
+  WIN32_FIND_DATA
+    data;
+
+  if (contains(_project->platformExcludes(_wizard->platform()),directory))
+    return;
+
+  fileHandle=FindFirstFile((relativePathForConfigure + directory + L"\\*.*").c_str(),&data);
+  do
+  {
+    if (fileHandle == INVALID_HANDLE_VALUE)
+      return;
+
+    if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == FILE_ATTRIBUTE_DIRECTORY)
+      continue;
+
+    if (isExcluded(data.cFileName))
+      continue;
+
+    if (isSrcFile(data.cFileName))
+      _srcFiles.push_back(relativePathForProject() + directory + L"/" + data.cFileName);
+    else if (endsWith(data.cFileName,L".h"))
+      _includeFiles.push_back(relativePathForProject() + directory + L"/" + data.cFileName);
+    else if (endsWith(data.cFileName,L".rc") && !_wizard->targetLinux())
+      _resourceFiles.push_back(relativePathForProject() + directory + L"/" + data.cFileName);
+
+  } while (FindNextFile(fileHandle,&data));
+
+  FindClose(fileHandle);
+}
+
+vector<wstring> ProjectFile::nasmOptions()
+{
+  vector<wstring>
+    includes,
+    result;
+
+  if (!useNasm())
+    return(result);
+
+  /* CMake selects the win32, win64 or elf object format but the sources also check these macros */
+  if (_wizard->platform() == Platform::X86)
+  {
+    result.push_back(L"$<IF:$<PLATFORM_ID:Windows>,-DWIN32,-DELF>");
+    /* The x86inc based kernels decorate their symbols for the cdecl calling convention */
+    result.push_back(L"$<$<PLATFORM_ID:Windows>:-DPREFIX>");
+  }
+  else
+  {
+    result.push_back(L"$<IF:$<PLATFORM_ID:Windows>,-DWIN64,-DELF>");
+    result.push_back(L"-D__x86_64__");
+  }
+
+  /* The kernels include files from their own directory */
+  foreach (wstring,dir,_project->directories())
+  {
+    if (!contains(_project->platformExcludes(_wizard->platform()),*dir))
+      includes.push_back(*dir);
+  }
+  merge(_project->includesNasm(),includes);
+
+  /* Versions of nasm before 2.14 require the trailing slash */
+  foreach (wstring,include,includes)
+    result.push_back(L"-I${CMAKE_CURRENT_SOURCE_DIR}/" + relativePathForProject() + *include + L"/");
+
+  /* The kernels include the generated assembly version of the configuration */
+  if (!_project->rtcd().empty())
+    result.push_back(L"-I" + rtcdDirectory() + L"/");
+
+  return(result);
+}
+
+void ProjectFile::merge(vector<wstring> &input, vector<wstring> &output)
+{
+  foreach (wstring,value,input)
+  {
+    if (!contains(output,*value))
+      output.push_back(*value);
+  }
+}
+
+wstring ProjectFile::interfaceLibrary() const
+{
+  if (isLib() || (_wizard->solutionType() != SolutionType::DYNAMIC_MT && (_project->isExe())))
+    return(L"magick_lib");
+  else if (_project->isDll())
+    return(L"magick_dll");
+
+  return(L"magick_common");
+}
+
+wstring ProjectFile::rtcdDirectory() const
+{
+  return(L"${CMAKE_CURRENT_BINARY_DIR}/" + name() + L"_rtcd");
+}
+
+wstring ProjectFile::relativePathForProject() const
+{
+  /* The fragments of the flat layout are included from the VisualMagick directory */
+  if (isFlat())
+    return(L"../");
+
+  return(L"../../../");
+}
+
+wstring ProjectFile::sourcePath(const wstring &fileName) const
+{
+  /* The patterns of the Config files are relative to the root of the source tree */
+  if (fileName.compare(0,relativePathForProject().length(),relativePathForProject()) == 0)
+    return(fileName.substr(relativePathForProject().length()));
+
+  return(fileName);
+}
+
+void ProjectFile::setFileName()
+{
+  if (isFlat())
+    _fileName = name() + L".cmake";
+  else
+    _fileName = L"CMakeLists.txt";
+}
+
+wstring ProjectFile::createGuid()
+{
+  GUID
+    guid;
+
+  RPC_WSTR
+    guidStr;
+
+  wstring
+    result;
+
+  (void) CoCreateGuid(&guid);
+  (void) UuidToString(&guid,&guidStr);
+  result=wstring((wchar_t *) guidStr);
+  transform(result.begin(),result.end(),result.begin(),::toupper);
+  RpcStringFree(&guidStr);
+  return result;
+}
+
+void ProjectFile::write(wofstream &file,const vector<Project*> &allProjects)
+{
+  writeHeader(file);
+
+  writeTarget(file);
+
+  writeIncludeDirectories(file);
+
+  writeRtcd(file);
+
+  writeCompileDefinitions(file);
+
+  writeCompileOptions(file);
+
+  writeProperties(file);
+
+  writeFiles(file,_srcFiles);
+  writeFiles(file,_includeFiles);
+  writeFiles(file,_resourceFiles);
+  writeSourceIsa(file);
+  writeIcon(file);
+
+  writeProjectReferences(file,allProjects);
+
+  writeInstall(file);
+
+  writeTests(file);
+
+  writeTools(file);
+}
+
+void ProjectFile::writeHeader(wofstream& file)
+{
+  /* The root CMakeLists.txt already declared the project and the standards */
+  if (isFlat())
+    return;
+
+  file << "cmake_minimum_required(VERSION " << _wizard->cmakeMinVersion() << ")" << endl;
+  file << "project(" << name() << " LANGUAGES C CXX ASM" << ")" << endl;
+
+  file << "set(CMAKE_CXX_STANDARD 17)" << endl;
+  file << "set(CMAKE_CXX_STANDARD_REQUIRED ON)" << endl;
+
+  file << "set(CMAKE_C_STANDARD 17)" << endl;
+  file << "set(CMAKE_C_STANDARD_REQUIRED ON)" << endl;
+
+  if (_project->useUnicode())
+  {
+    file << "add_definitions(-UNICODE -D_UNICODE)" << endl;
+  }
+}
+
+void ProjectFile::writeTarget(wofstream& file)
+{
+  if (isObjectLibrary())
+  {
+    file << "add_library(" << name() << " OBJECT" << ")" << endl;
+  }
+  else if (isLib())
+  {
+    file << "add_library(" << name() << " STATIC" << ")" << endl;
+  }
+  else if (_project->isDll())
+  {
+    file << "add_library(" << name() << " SHARED" << ")" << endl;
+  }
+  else if (_project->isExe())
+  {
+    file << "add_executable(" << name() << ")" << endl;
+  }
+
+  file << "target_link_libraries(" << name() << " PRIVATE " << interfaceLibrary() << ")" << endl;
+}
+
+void ProjectFile::writeIncludeDirectories(wostream& file)
+{
+  vector<pair<wstring,wstring>>
+    includeDirectories;
+
+  wstring
+    scope;
+
+  for (wstring projectDir : _project->directories())
+  {
+    bool skip = false;
+
+    for (wstring includeDir : _includes)
+    {
+      if (projectDir.find(includeDir) == 0)
+      {
+        skip = true;
+        break;
+      }
+    }
+
+    if (!skip)
+    {
+      includeDirectories.push_back(make_pair(L"PUBLIC",relativePathForProject() + projectDir));
+    }
+  }
+
+  for (wstring includeDir : _includes)
+  {
+    includeDirectories.push_back(make_pair(visibility(includeDir,_includesPrivate,_includesInterface),relativePathForProject() + includeDir));
+  }
+
+  /* Only the ImageMagick sources use the OpenCL headers */
+  if (_wizard->useOpenCL() && _project->isMagickProject())
+  {
+    includeDirectories.push_back(make_pair(L"PRIVATE",relativePathForProject() + L"VisualMagick/OpenCL"));
+  }
+
+  if (!_variant.empty())
+  {
+    file << "target_include_directories(" << name() << " BEFORE PUBLIC " << relativePathForProject() << "VisualMagick/variants/" << _variant << ")" << endl;
+  }
+
+  if (includeDirectories.empty())
+    return;
+
+  /* The directories keep the order of the Config file, the scope is repeated when it changes */
+  file << "target_include_directories(" << name();
+  for (const auto& includeDir : includeDirectories)
+  {
+    if (includeDir.first != scope)
+    {
+      scope=includeDir.first;
+      file << "\n" << "  " << scope;
+    }
+    /* The exported targets use the copy of the headers in the installed package */
+    if (isExported() && scope != L"PRIVATE")
+    {
+      file << "\n" << "    $<BUILD_INTERFACE:${CMAKE_CURRENT_SOURCE_DIR}/" << includeDir.second << ">";
+      file << "\n" << "    $<INSTALL_INTERFACE:include/" << includeDir.second.substr(relativePathForProject().length()) << ">";
+    }
+    else
+      file << "\n" << "    " << includeDir.second;
+  }
+  file << "\n)" << endl;
+}
+
+void ProjectFile::writeCompileDefinitions(wostream& file)
+{
+  vector<wstring>
+    defines;
+
+  /* The common definitions are provided by the magick_common, magick_lib and magick_dll targets */
+  merge(_project->defines(),defines);
+  merge(_project->platformDefines(_wizard->platform()),defines);
+  if (_wizard->targetLinux())
+    merge(_project->definesLinux(),defines);
+
+  if (isFlat() && _project->useUnicode())
+  {
+    defines.push_back(L"UNICODE");
+    defines.push_back(L"_UNICODE");
+  }
+
+  if (isLib() || (_wizard->solutionType() != SolutionType::DYNAMIC_MT && (_project->isExe())))
+    merge(_definesLib,defines);
+  else if (_project->isDll())
+    merge(_project->definesDll(),defines);
+
+  if (defines.empty())
+    return;
+
+  file << "target_compile_definitions(" << name() << " PRIVATE ";
+  for (wstring def : defines)
+  {
+    file << "\n" << "  " << excludeMsvc(def,def);
+  }
+  file << "\n)" << endl;
+}
+
+void ProjectFile::writeCompileOptions(wostream& file)
+{
+  wstring
+    warningLevel;
+
+  warningLevel=to_wstring(_project->warningLevel());
+
+  file << "target_compile_options(" << name() << " PRIVATE";
+  file << "\n" << "  " << toolchainOption(L"/W" + warningLevel,L"/W" + warningLevel,_project->warningLevel() == 0 ? L"-w" : L"-Wall");
+  /* GCC and Clang report a different set of warnings so -Werror is not used */
+  if (_project->treatWarningAsError())
+    file << "\n" << "  " << toolchainOption(L"/WX",L"/WX",L"");
+  if (_project->compiler(_wizard->visualStudioVersion()) == Compiler::CPP)
+    file << "\n" << "  " << toolchainOption(L"/TP",L"/TP",L"");
+  if (_isa == L"avx2")
+  {
+    file << "\n" << "  " << toolchainOption(L"/arch:AVX2",L"/arch:AVX2",L"-mavx2");
+    file << "\n" << "  " << toolchainOption(L"",L"",L"-mfma");
+  }
+  for (wstring option : nasmOptions())
+  {
+    file << "\n" << "  $<$<COMPILE_LANGUAGE:ASM_NASM>:" << option << ">";
+  }
+  file << "\n)" << endl;
+}
+
+void ProjectFile::writeProperties(wostream& file)
+{
+  if (_project->isFuzz())
+  {
+    file << "set_target_properties(" << name() << " PROPERTIES " << endl;
+    file << "  RUNTIME_OUTPUT_DIRECTORY " << _wizard->fuzzBinDirectory() << endl;
+    file << ")" << endl;
+  }
+
+  /* The variants use the same file names in their own output directories */
+  if (!_variant.empty())
+  {
+    file << "set_target_properties(" << name() << " PROPERTIES " << endl;
+    file << "  OUTPUT_NAME " << _prefix << "_" << _name << endl;
+    file << "  RUNTIME_OUTPUT_DIRECTORY " << (_project->isFuzz() ? _wizard->fuzzBinDirectory() : _wizard->binDirectory()) << _variant << endl;
+    file << "  LIBRARY_OUTPUT_DIRECTORY " << _wizard->libDirectory() << _variant << endl;
+    file << "  ARCHIVE_OUTPUT_DIRECTORY " << _wizard->libDirectory() << _variant << endl;
+    file << ")" << endl;
+  }
+
+  if (_project->isModule() && _project->isDll() && !isLib())
+  {
+    file << "set_target_properties(" << name() << " PROPERTIES " << endl;
+    file << "  OUTPUT_NAME_DEBUG " << getTargetName(true) << endl;
+    file << "  OUTPUT_NAME_RELEASE " << getTargetName(false) << endl;
+    file << ")" << endl;
+  }
+
+  /* The loader shim in MagickCore selects the AVX2 modules when the processor supports them */
+  if (!_isa.empty())
+  {
+    file << "set_target_properties(" << name() << " PROPERTIES " << endl;
+    file << "  RUNTIME_OUTPUT_DIRECTORY " << _wizard->binDirectory() << _variant << (_variant.empty() ? L"" : L"/") << "$<$<BOOL:${CMAKE_CONFIGURATION_TYPES}>:$<CONFIG>/>modules-" << _isa << (_project->modulePrefix() == L"FILTER" ? L"/filters" : L"/coders") << endl;
+    file << "  ARCHIVE_OUTPUT_DIRECTORY " << _wizard->libDirectory() << _variant << (_variant.empty() ? L"" : L"/") << _isa << endl;
+    file << ")" << endl;
+  }
+
+  /* The job pools are defined by the root CMakeLists.txt and only used by the Ninja generators */
+  if (!_jobPoolLink.empty())
+  {
+    file << "set_target_properties(" << name() << " PROPERTIES " << endl;
+    file << "  JOB_POOL_COMPILE magick_compile" << endl;
+    file << "  JOB_POOL_LINK " << _jobPoolLink << endl;
+    file << ")" << endl;
+  }
+}
+
+void ProjectFile::writeAdditionalDependencies(wofstream &file,const wstring &separator)
+{
+  foreach (wstring,lib,_project->libraries())
+  {
+    file << separator << *lib;
+  }
+}
+
+void ProjectFile::writeAdditionalIncludeDirectories(wofstream &file,const wstring &separator)
+{
+  foreach (wstring,projectDir,_project->directories())
+  {
+    bool
+      skip;
+
+    skip=false;
+    foreach (wstring,includeDir,_includes)
+    {
+      if ((*projectDir).find(*includeDir) == 0)
+      {
+        skip=true;
+        break;
+      }
+    }
+
+    if (!skip)
+      file << separator << relativePathForProject() <<  *projectDir;
+  }
+  foreach (wstring,includeDir,_includes)
+  {
+    file << separator << relativePathForProject() << *includeDir;
+  }
+  if (_wizard->useOpenCL())
+    file << separator << relativePathForProject() << L"VisualMagick/OpenCL";
+}
+
+void ProjectFile::writeIcon(wofstream &file)
+{
+  if (!_project->isExe() || _project->icon() == L"" || _wizard->targetLinux())
+    return;
+
+  file << "target_sources(" << name() << " PRIVATE" << endl;
+  if (isFlat())
+    file << "  VisualStudioProjects/" << name() << "/" << name() << ".rc" << endl;
+  else
+    file << "  " << name() << ".rc" << endl;
+  file << ")" << endl;
+}
+
+void ProjectFile::writeInstall(wofstream &file)
+{
+  if (!isExported())
+    return;
+
+  file << "install(TARGETS " << name() << " EXPORT MagickDelegates" << endl;
+  file << "  RUNTIME DESTINATION bin" << endl;
+  file << "  LIBRARY DESTINATION lib" << endl;
+  file << "  ARCHIVE DESTINATION lib" << endl;
+  file << ")" << endl;
+
+  for (wstring projectDir : _project->directories())
+  {
+    file << "install(DIRECTORY " << relativePathForProject() << projectDir << "/ DESTINATION include/" << projectDir << " FILES_MATCHING PATTERN \"*.h\")" << endl;
+  }
+
+  for (wstring includeDir : _includes)
+  {
+    if (contains(_includesPrivate,includeDir))
+      continue;
+
+    file << "install(DIRECTORY " << relativePathForProject() << includeDir << "/ DESTINATION include/" << includeDir << " FILES_MATCHING PATTERN \"*.h\")" << endl;
+  }
+}
+
+void ProjectFile::writeRtcd(wofstream &file)
+{
+  wstring
+    arch,
+    config,
+    name,
+    value;
+
+  vector<wstring>
+    defines,
+    disabled;
+
+  size_t
+    index;
+
+  if (_project->rtcd().empty())
+    return;
+
+  switch (_wizard->platform())
+  {
+    case Platform::X86: arch=L"x86"; break;
+    case Platform::X64: arch=L"x86_64"; break;
+    case Platform::ARM64: arch=L"arm64"; break;
+    default: throw;
+  }
+
+  config=filesystem::path(_project->rtcdConfig()).filename().wstring();
+
+  /* The configuration of the sources is patched with the HAVE_ and ARCH_ values of the platform */
+  file << "find_package(Perl REQUIRED)" << endl;
+  file << "file(READ " << relativePathForProject() << _project->rtcdConfig() << " MAGICK_RTCD_CONFIG)" << endl;
+  merge(_project->defines(),defines);
+  merge(_project->platformDefines(_wizard->platform()),defines);
+  foreach (wstring,define,defines)
+  {
+    index=define->find(L"=");
+    if (index == wstring::npos)
+      continue;
+
+    name=define->substr(0,index);
+    value=define->substr(index+1);
+    file << "string(REGEX REPLACE \"#define " << name << " [0-9]+\" \"#define " << name << " " << value << "\" MAGICK_RTCD_CONFIG \"${MAGICK_RTCD_CONFIG}\")" << endl;
+    if (startsWith(name,L"HAVE_") && value == L"0")
+      disabled.push_back(L"--disable-" + toLower(name.substr(5)));
+  }
+  file << "file(CONFIGURE OUTPUT " << rtcdDirectory() << "/config/" << config << " CONTENT \"${MAGICK_RTCD_CONFIG}\" @ONLY)" << endl;
+
+  /* The assembly kernels include the same configuration with the nasm syntax */
+  file << "string(REGEX MATCHALL \"#define [A-Z0-9_]+ [0-9]+\" MAGICK_RTCD_DEFINES \"${MAGICK_RTCD_CONFIG}\")" << endl;
+  file << "list(TRANSFORM MAGICK_RTCD_DEFINES REPLACE \"^#define\" \"%define\")" << endl;
+  file << "list(JOIN MAGICK_RTCD_DEFINES \"\\n\" MAGICK_RTCD_DEFINES)" << endl;
+  file << "file(CONFIGURE OUTPUT " << rtcdDirectory() << "/config/" << filesystem::path(config).stem().wstring() << ".asm CONTENT \"${MAGICK_RTCD_DEFINES}\\n\" @ONLY)" << endl;
+
+  /* The dispatch tables are generated at configure time like the upstream build does */
+  foreach (wstring,line,_project->rtcd())
+  {
+    index=line->find(L" ");
+    name=line->substr(0,index);
+    value=trim(line->substr(index+1));
+    file << "execute_process(" << endl;
+    file << "  COMMAND \"${PERL_EXECUTABLE}\" " << relativePathForProject() << _project->rtcdScript() << " --arch=" << arch << " --sym=" << name;
+    foreach (wstring,flag,disabled)
+      file << " " << *flag;
+    file << " --config=" << rtcdDirectory() << "/config/" << config << " " << relativePathForProject() << value << endl;
+    file << "  WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}" << endl;
+    file << "  OUTPUT_FILE " << rtcdDirectory() << "/config/" << name << ".h.tmp" << endl;
+    file << "  RESULT_VARIABLE MAGICK_RTCD_RESULT)" << endl;
+    file << "if(NOT MAGICK_RTCD_RESULT EQUAL 0)" << endl;
+    file << "  message(FATAL_ERROR \"Unable to generate " << name << ".h\")" << endl;
+    file << "endif()" << endl;
+    file << "configure_file(" << rtcdDirectory() << "/config/" << name << ".h.tmp " << rtcdDirectory() << "/config/" << name << ".h COPYONLY)" << endl;
+    file << "set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${CMAKE_CURRENT_SOURCE_DIR}/" << relativePathForProject() << value << ")" << endl;
+  }
+  file << "set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${CMAKE_CURRENT_SOURCE_DIR}/" << relativePathForProject() << _project->rtcdConfig() << " ${CMAKE_CURRENT_SOURCE_DIR}/" << relativePathForProject() << _project->rtcdScript() << ")" << endl;
+
+  /* The generated headers replace the C only copies in the config directory of the sources */
+  file << "target_include_directories(" << this->name() << " BEFORE PRIVATE " << rtcdDirectory() << ")" << endl;
+}
+
+void ProjectFile::writeSourceIsa(wofstream &file)
+{
+  size_t
+    index;
+
+  wstring
+    directory,
+    isa,
+    pattern;
+
+  vector<wstring>
+    files;
+
+  /* The kernels for a newer instruction set are only called after the runtime detection */
+  foreach (wstring,line,_project->sourceIsa())
+  {
+    index=line->find(L" ");
+    pattern=line->substr(0,index);
+    isa=trim(line->substr(index+1));
+
+    files.clear();
+    for (const wstring& f : _srcFiles)
+    {
+      /* The patterns with a directory are matched against the path of the file */
+      if (contains(vector<wstring>{pattern},pattern.find(L"/") != wstring::npos ? sourcePath(f) : filesystem::path(f).filename().wstring()))
+        files.push_back(f);
+    }
+    if (files.empty())
+    {
+      /* A pattern for a directory that is built must match, otherwise its kernels are compiled without the switch */
+      index=pattern.find_last_of(L"/");
+      directory=index == wstring::npos ? L"" : pattern.substr(0,index);
+      if (contains(_project->directories(),directory) && !contains(_project->platformExcludes(_wizard->platform()),directory))
+        throwException(L"The source isa pattern " + pattern + L" of " + name() + L" matches no source files");
+      continue;
+    }
+
+    file << "set_source_files_properties(" << endl;
+    for (const wstring& f : files)
+      file << "  " << f << endl;
+    file << "  PROPERTIES COMPILE_OPTIONS \"" << replace(sourceIsaOption(isa),L" ",L";") << "\"" << endl;
+    file << ")" << endl;
+  }
+}
+
+void ProjectFile::writeTests(wofstream &file)
+{
+  wstring
+    testName;
+
+  foreach_const(wstring,test,_project->tests())
+  {
+    testName=name() + L"_" + filesystem::path(*test).stem().wstring();
+
+    file << "add_executable(" << testName << " " << relativePathForProject() << *test << ")" << endl;
+    file << "set_target_properties(" << testName << " PROPERTIES RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})" << endl;
+    if (isLib())
+    {
+      file << "target_link_libraries(" << testName << " PRIVATE magick_lib " << name() << ")" << endl;
+    }
+    else
+    {
+      /* The tests use the internal functions that are not exported by the DLL */
+      file << "target_sources(" << testName << " PRIVATE $<TARGET_PROPERTY:" << name() << ",SOURCES>)" << endl;
+      file << "target_include_directories(" << testName << " PRIVATE $<TARGET_PROPERTY:" << name() << ",INCLUDE_DIRECTORIES>)" << endl;
+      file << "target_compile_definitions(" << testName << " PRIVATE $<TARGET_PROPERTY:" << name() << ",COMPILE_DEFINITIONS>)" << endl;
+      file << "target_compile_options(" << testName << " PRIVATE $<TARGET_PROPERTY:" << name() << ",COMPILE_OPTIONS>)" << endl;
+      file << "target_link_libraries(" << testName << " PRIVATE $<TARGET_PROPERTY:" << name() << ",LINK_LIBRARIES>)" << endl;
+    }
+    file << "add_test(NAME " << testName << " COMMAND " << testName << ")" << endl;
+  }
+}
+
+void ProjectFile::writeTools(wofstream &file)
+{
+  size_t
+    index;
+
+  wstring
+    output,
+    source,
+    toolName;
+
+  foreach_const(wstring,tool,_project->tools())
+  {
+    index=tool->find(L" ");
+    source=index == wstring::npos ? *tool : tool->substr(0,index);
+    output=index == wstring::npos ? L"" : trim(tool->substr(index+1));
+    toolName=filesystem::path(source).stem().wstring();
+
+    file << "add_executable(" << toolName << " " << relativePathForProject() << source << ")" << endl;
+    file << "target_include_directories(" << toolName << " PRIVATE $<TARGET_PROPERTY:" << name() << ",INCLUDE_DIRECTORIES>)" << endl;
+    file << "target_link_libraries(" << toolName << " PRIVATE " << (_wizard->solutionType() != SolutionType::DYNAMIC_MT ? L"magick_lib " : L"magick_common ") << name() << ")" << endl;
+    /* The ARM64 tools cannot run on the x64 build machines */
+    if (!output.empty() && _wizard->platform() != Platform::ARM64)
+    {
+      file << "if(NOT CMAKE_CROSSCOMPILING)" << endl;
+      file << "  add_custom_command(TARGET " << toolName << " POST_BUILD" << endl;
+      file << "    COMMAND " << toolName << " \"$<TARGET_FILE_DIR:" << toolName << ">/" << output << "\"" << endl;
+      file << "    COMMENT \"Generating " << output << "\"" << endl;
+      file << "    VERBATIM" << endl;
+      file << "  )" << endl;
+      file << "endif()" << endl;
+    }
+    if (isExported())
+    {
+      file << "install(TARGETS " << toolName << " RUNTIME DESTINATION bin)" << endl;
+      if (!output.empty())
+        file << "install(FILES \"$<TARGET_FILE_DIR:" << toolName << ">/" << output << "\" DESTINATION bin OPTIONAL)" << endl;
+    }
+  }
+}
+
+void ProjectFile::writeFiles(wofstream &file,const vector<wstring> &collection)
+{
+  int
+    count;
+
+  map<wstring, int>
+    fileCount;
+
+  wstring
+    fileName,
+    folder,
+    name;
+
+  if (collection.size() == 0)
+    return;
+
+  file << "target_sources(" << this->name() << " PRIVATE" << endl;
+  for (const wstring& f : collection)
+  {
+    file << "  " << excludeMsvc(f,filesystem::path(f).filename().wstring()) << endl;
+  }
+  file << ")" << endl;
+
+  /* The kernels use the nasm syntax that cannot be assembled by the ASM language of the compiler */
+  if (useNasm())
+  {
+    count=0;
+    for (const wstring& f : collection)
+    {
+      if (!endsWith(f, L".asm"))
+        continue;
+
+      if (count++ == 0)
+        file << "set_source_files_properties(" << endl;
+      file << "  " << f << endl;
+    }
+    if (count > 0)
+      file << "  PROPERTIES LANGUAGE ASM_NASM" << endl << ")" << endl;
+  }
+
+  if (_project->compiler(_wizard->visualStudioVersion()) != Compiler::CPP)
+    return;
+
+  count=0;
+  for (const wstring& f : collection)
+  {
+    if (endsWith(f, L".asm") || endsWith(f, L".S") || endsWith(f, L".rc") || endsWith(f, L".h"))
+      continue;
+
+    if (count++ == 0)
+      file << "set_source_files_properties(" << endl;
+    file << "  " << f << endl;
+  }
+  if (count > 0)
+    file << "  PROPERTIES LANGUAGE CXX" << endl << ")" << endl;
+}
+
+void ProjectFile::writePreprocessorDefinitions(wofstream &file,const bool debug)
+{
+  file << (debug ? "_DEBUG" : "NDEBUG") << ";_WINDOWS;WIN32;_VISUALC_;NeedFunctionPrototypes";
+  foreach (wstring,def,_project->defines())
+  {
+    file << ";" << *def;
+  }
+  if (isLib() || (_wizard->solutionType() != SolutionType::DYNAMIC_MT && (_project->isExe())))
+  {
+    foreach (wstring,def,_definesLib)
+    {
+      file << ";" << *def;
+    }
+    file << ";_LIB";
+  }
+  else if (_project->isDll())
+  {
+    foreach (wstring,def,_project->definesDll())
+    {
+      file << ";" << *def;
+    }
+    file << ";_DLL;_MAGICKMOD_";
+  }
+  if (_project->isExe() && _wizard->solutionType() != SolutionType::STATIC_MT)
+    file << ";_AFXDLL";
+  if (_wizard->includeIncompatibleLicense())
+    file << ";_MAGICK_INCOMPATIBLE_LICENSES_";
+}
+
+void ProjectFile::writeProjectReferences(wofstream &file,const vector<Project*> &allProjects)
+{
+  size_t
+    index;
+
+  wstring
+    projectName,
+    projectFileName,
+    scope,
+    targetName;
+
+  set<wstring>
+    linked;
+
+  vector<wstring>
+    delayLoad,
+    usageRequirements;
+
+  bool hasDep = false;
+
+  for (const wstring& dep : _dependencies)
+  {
+    projectName = dep;
+    projectFileName = L"";
+    index = dep.find(L">");
+    if (index != -1)
+    {
+      projectName = dep.substr(0, index);
+      projectFileName = dep.substr(index + 1);
+    }
+
+    /* Nothing links against an executable so it never passes its dependencies on */
+    scope = _project->isExe() ? L"PRIVATE" : visibility(dep,_dependenciesPrivate,_dependenciesInterface);
+
+    for (const auto& depp : allProjects)
+    {
+      if (depp->name() != projectName)
+        continue;
+
+      for (const auto& deppf : depp->files())
+      {
+        if (!isDependency(projectFileName,deppf))
+          continue;
+
+        /* Linking an object library adds its objects so the other targets only use its usage requirements */
+        if (deppf->isObjectLibrary() && !isObjectLibrary() && !contains(_absorbed,deppf->name()))
+        {
+          usageRequirements.push_back(deppf->name());
+          continue;
+        }
+
+        if (!hasDep)
+        {
+          hasDep = true;
+          file << "target_link_libraries(" << name() << endl;
+        }
+
+        /* The ImageMagick stage uses the imported targets of the delegates stage */
+        targetName=(deppf->isExported() && !isExported()) ? L"MagickDelegates::" + deppf->name() : deppf->name();
+
+        file << "  " << scope << " " << targetName << endl;
+        linked.insert(deppf->name());
+
+        if (_wizard->delayLoadDelegates() && depp->delayLoad() && !deppf->isLib())
+          delayLoad.push_back(targetName);
+      }
+    }
+  }
+
+  /* The objects of the indirect dependencies must also be absorbed */
+  for (const wstring& absorbed : _absorbed)
+  {
+    if (linked.find(absorbed) != linked.end())
+      continue;
+
+    if (!hasDep)
+    {
+      hasDep = true;
+      file << "target_link_libraries(" << name() << endl;
+    }
+
+    file << "  PRIVATE " << absorbed << endl;
+  }
+
+  if (hasDep)
+  {
+    file << ")" << endl;
+  }
+
+  /* The Windows threads are part of the runtime library */
+  if (_project->useThreads() && _wizard->targetLinux())
+  {
+    file << "find_package(Threads REQUIRED)" << endl;
+    file << "target_link_libraries(" << name() << " PRIVATE Threads::Threads)" << endl;
+  }
+
+  for (const wstring& dep : usageRequirements)
+  {
+    file << "target_include_directories(" << name() << " PRIVATE $<TARGET_PROPERTY:" << dep << ",INTERFACE_INCLUDE_DIRECTORIES>)" << endl;
+    file << "target_compile_definitions(" << name() << " PRIVATE $<TARGET_PROPERTY:" << dep << ",INTERFACE_COMPILE_DEFINITIONS>)" << endl;
+  }
+
+  if (delayLoad.empty())
+    return;
+
+  /* Only the MSVC linker (also used by clang-cl) supports delay loading */
+  file << "target_link_options(" << name() << " PRIVATE";
+  for (const wstring& dep : delayLoad)
+  {
+    file << "\n" << "  " << toolchainOption(L"/DELAYLOAD:$<TARGET_FILE_NAME:" + dep + L">",L"/DELAYLOAD:$<TARGET_FILE_NAME:" + dep + L">",L"");
+  }
+  file << "\n)" << endl;
+  file << "target_link_libraries(" << name() << " PRIVATE " << toolchainOption(L"delayimp",L"delayimp",L"") << ")" << endl;
+}
+
+wstring ProjectFile::visibility(const wstring &value,const vector<wstring> &privateValues,const vector<wstring> &interfaceValues) const
+{
+  if (contains(privateValues,value))
+    return(L"PRIVATE");
+  else if (contains(interfaceValues,value))
+    return(L"INTERFACE");
+
+  return(L"PUBLIC");
+}
@@ -1,182 +1,364 @@
-/*
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-%                                                                             %
-%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
-%  dedicated to making software imaging solutions freely available.           %
-%                                                                             %
-%  You may not use this file except in compliance with the License.  You may  %
-%  obtain a copy of the License at                                            %
-%                                                                             %
-%    http://www.imagemagick.org/script/license.php                            %
-%                                                                             %
-%  Unless required by applicable law or agreed to in writing, software        %
-%  distributed under the License is distributed on an "AS IS" BASIS,          %
-%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
-%  See the License for the specific language governing permissions and        %
-%  limitations under the License.                                             %
-%                                                                             %
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-*/
-#ifndef __Shared__
-#define __Shared__
-
-#include <algorithm>
-#include <functional>
-#include <cctype>
-#include <locale>
-#include <filesystem>
-
-enum class Compiler {Default, CPP};
-
-enum class Platform {X86, X64, ARM64};
-
-enum class PolicyConfig {LIMITED, OPEN, SECURE, WEBSAFE};
-
-enum class ProjectType {UNDEFINEDTYPE, APPTYPE, DLLTYPE, DLLMODULETYPE, EXETYPE, EXEMODULETYPE, STATICTYPE};
-
-enum class QuantumDepth {Q8, Q16, Q32, Q64};
-
-enum class SolutionType {DYNAMIC_MT, STATIC_MTD, STATIC_MT};
-
-enum class VisualStudioVersion {VS2017, VS2019, VS2022};
-
-#define VSEARLIEST VisualStudioVersion::VS2017
-#define VSLATEST VisualStudioVersion::VS2022
-
-static const wstring validSrcFilesArr[] = {L".c", L".cpp", L".cc"};
-const vector<wstring> validSrcFiles(validSrcFilesArr, std::end(validSrcFilesArr));
-
-#define foreach(type,var,collection) for(std::vector<type>::iterator var = collection.begin(); var != collection.end(); var++)
-#define foreach_const(type,var,collection) for(std::vector<type>::const_iterator var = collection.begin(); var != collection.end(); var++)
-
-static inline bool endsWith(const wstring &s,const wstring &end)
-{
-  size_t
-    index;
-
-  index=s.rfind(end);
-  if (index == wstring::npos)
-    return(false);
-
-  return(s.substr(index) == end);
-}
-
-static inline bool startsWith(const wstring &s,const wstring &start)
-{
-  size_t
-    index;
-
-  index=s.rfind(start);
-  return(index != wstring::npos);
-}
-
-static inline bool contains(const vector<wstring> &container, const wstring s)
-{
-  foreach_const(wstring,c,container)
-  {
-    if (*c == s)
-      return(true);
-    if (((*c)[0] == '*') && (endsWith(s,(*c).substr(1))))
-      return(true);
-    if (((*c)[(*c).length()-1] == '*') && (startsWith(s,(*c).substr(0,(*c).length()-1))))
-      return(true);
-  }
-  return(false);
-}
-
-static bool directoryExists(const std::wstring& folderPath)
-{
-  DWORD
-    folderAttr = GetFileAttributesW(folderPath.c_str());
-
-  if (folderAttr == INVALID_FILE_ATTRIBUTES)
-    return false;
-  return (folderAttr & FILE_ATTRIBUTE_DIRECTORY);
-}
-
-static inline wstring trim(const wstring &s)
-{
-  wstring
-    result;
-
-  result=s;
-  result.erase(result.begin(), find_if(result.begin(), result.end(), [](int c) {return !std::isspace(c);}));
-  result.erase(find_if(result.rbegin(), result.rend(), [](int c) {return !std::isspace(c);}).base(), result.end());
-  return(result);
-}
-
-static inline void throwException(const wstring& message)
-{
-  throw runtime_error(string(message.begin(), message.end()));
-}
-
-static inline wstring readLine(wifstream &stream)
-{
-  wstring
-    line;
-
-  getline(stream,line);
-  return(trim(line));
-}
-
-static inline wstring readLicense(const wstring &fileName)
-{
-  wifstream
-    file;
-
-  wstring
-    content;
-
-  file.open(fileName);
-  if (!file)
-    throwException(L"Unable to open license file: " + fileName);
-
-  content=trim(wstring((istreambuf_iterator<wchar_t>(file)),istreambuf_iterator<wchar_t>()));
-
-  file.close();
-
-  return(content);
-}
-
-static inline wstring replace(const wstring &str,const wstring &from,const wstring &to)
-{
-  size_t
-    index;
-
-  wstring
-    result;
-
-  result=str;
-  index=result.find(from);
-  while (index != string::npos)
-  {
-    result.replace(index,from.length(),to);
-    index=result.find(from,index+to.length());
-  }
-  return(result);
-}
-
-static inline VisualStudioVersion parseVisualStudioVersion(const wstring &version)
-{
-  if (version == L"2017")
-    return(VisualStudioVersion::VS2017);
-  else if (version == L"2019")
-    return(VisualStudioVersion::VS2019);
-  else if (version == L"2022")
-    return(VisualStudioVersion::VS2022);
-
-  return(VSEARLIEST);
-}
-
-static inline bool isValidSrcFile(const wstring &fileName)
-{
-  foreach_const(wstring,ext,validSrcFiles)
-  {
-    if (endsWith(fileName,*ext))
-      return(true);
-  }
-
-  return(false);
-}
-
-#endif // __Shared__
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#ifndef __Shared__
+#define __Shared__
+
+#include <algorithm>
+#include <functional>
+#include <cctype>
+#include <locale>
+#include <filesystem>
+
+enum class Compiler {Default, CPP};
+
+enum class Platform {X86, X64, ARM64};
+
+enum class PolicyConfig {LIMITED, OPEN, SECURE, WEBSAFE};
+
+enum class ProjectType {UNDEFINEDTYPE, APPTYPE, DLLTYPE, DLLMODULETYPE, EXETYPE, EXEMODULETYPE, STATICTYPE};
+
+enum class QuantumDepth {Q8, Q16, Q32, Q64};
+
+enum class SolutionType {DYNAMIC_MT, STATIC_MTD, STATIC_MT};
+
+enum class TargetIsa {BASELINE, X86_64_V2, X86_64_V3, X86_64_V4, ARMV8_2};
+
+enum class Toolchain {MSVC, ClangCL, GNU};
+
+enum class VisualStudioVersion {VS2017, VS2019, VS2022};
+
+#define VSEARLIEST VisualStudioVersion::VS2017
+#define VSLATEST VisualStudioVersion::VS2022
+
+static const wstring validSrcFilesArr[] = {L".c", L".cpp", L".cc"};
+const vector<wstring> validSrcFiles(validSrcFilesArr, std::end(validSrcFilesArr));
+
+#define foreach(type,var,collection) for(std::vector<type>::iterator var = collection.begin(); var != collection.end(); var++)
+#define foreach_const(type,var,collection) for(std::vector<type>::const_iterator var = collection.begin(); var != collection.end(); var++)
+
+static inline bool endsWith(const wstring &s,const wstring &end)
+{
+  size_t
+    index;
+
+  index=s.rfind(end);
+  if (index == wstring::npos)
+    return(false);
+
+  return(s.substr(index) == end);
+}
+
+static inline bool startsWith(const wstring &s,const wstring &start)
+{
+  size_t
+    index;
+
+  index=s.rfind(start);
+  return(index != wstring::npos);
+}
+
+static inline bool contains(const vector<wstring> &container, const wstring s)
+{
+  foreach_const(wstring,c,container)
+  {
+    if (*c == s)
+      return(true);
+    if (((*c)[0] == '*') && (endsWith(s,(*c).substr(1))))
+      return(true);
+    if (((*c)[(*c).length()-1] == '*') && (startsWith(s,(*c).substr(0,(*c).length()-1))))
+      return(true);
+  }
+  return(false);
+}
+
+static bool directoryExists(const std::wstring& folderPath)
+{
+  DWORD
+    folderAttr = GetFileAttributesW(folderPath.c_str());
+
+  if (folderAttr == INVALID_FILE_ATTRIBUTES)
+    return false;
+  return (folderAttr & FILE_ATTRIBUTE_DIRECTORY);
+}
+
+static inline wstring trim(const wstring &s)
+{
+  wstring
+    result;
+
+  result=s;
+  result.erase(result.begin(), find_if(result.begin(), result.end(), [](int c) {return !std::isspace(c);}));
+  result.erase(find_if(result.rbegin(), result.rend(), [](int c) {return !std::isspace(c);}).base(), result.end());
+  return(result);
+}
+
+static inline void throwException(const wstring& message)
+{
+  throw runtime_error(string(message.begin(), message.end()));
+}
+
+static inline wstring readLine(wifstream &stream)
+{
+  wstring
+    line;
+
+  getline(stream,line);
+  return(trim(line));
+}
+
+static inline void addScopedLines(wifstream &config,vector<wstring> &container,vector<wstring> &scope)
+{
+  wstring
+    line;
+
+  /* The lines of a PRIVATE or INTERFACE section are also added to the section without a scope */
+  while (!config.eof())
+  {
+    line=readLine(config);
+    if (line.empty())
+      return;
+
+    std::replace(line.begin(),line.end(),L'\\',L'/');
+
+    if (!contains(container,line))
+      container.push_back(line);
+    if (!contains(scope,line))
+      scope.push_back(line);
+  }
+}
+
+static inline wstring readLicense(const wstring &fileName)
+{
+  wifstream
+    file;
+
+  wstring
+    content;
+
+  file.open(fileName);
+  if (!file)
+    throwException(L"Unable to open license file: " + fileName);
+
+  content=trim(wstring((istreambuf_iterator<wchar_t>(file)),istreambuf_iterator<wchar_t>()));
+
+  file.close();
+
+  return(content);
+}
+
+static inline wstring replace(const wstring &str,const wstring &from,const wstring &to)
+{
+  size_t
+    index;
+
+  wstring
+    result;
+
+  result=str;
+  index=result.find(from);
+  while (index != string::npos)
+  {
+    result.replace(index,from.length(),to);
+    index=result.find(from,index+to.length());
+  }
+  return(result);
+}
+
+static inline wstring toLower(const wstring &s)
+{
+  wstring
+    result;
+
+  result=s;
+  transform(result.begin(),result.end(),result.begin(),::towlower);
+  return(result);
+}
+
+static inline wstring toUpper(const wstring &s)
+{
+  wstring
+    result;
+
+  result=s;
+  transform(result.begin(),result.end(),result.begin(),::towupper);
+  return(result);
+}
+
+static inline VisualStudioVersion parseVisualStudioVersion(const wstring &version)
+{
+  if (version == L"2017")
+    return(VisualStudioVersion::VS2017);
+  else if (version == L"2019")
+    return(VisualStudioVersion::VS2019);
+  else if (version == L"2022")
+    return(VisualStudioVersion::VS2022);
+
+  return(VSEARLIEST);
+}
+
+static inline TargetIsa parseTargetIsa(const wstring &isa)
+{
+  if (isa == L"x86-64-v2")
+    return(TargetIsa::X86_64_V2);
+  else if (isa == L"x86-64-v3")
+    return(TargetIsa::X86_64_V3);
+  else if (isa == L"x86-64-v4")
+    return(TargetIsa::X86_64_V4);
+  else if (isa == L"armv8.2")
+    return(TargetIsa::ARMV8_2);
+  else if ((isa == L"baseline") || (isa.empty()))
+    return(TargetIsa::BASELINE);
+
+  throwException(L"Invalid ISA level: " + isa);
+  return(TargetIsa::BASELINE);
+}
+
+static inline wstring targetIsaName(const TargetIsa isa)
+{
+  switch (isa)
+  {
+    case TargetIsa::BASELINE: return(L"");
+    case TargetIsa::X86_64_V2: return(L"x86-64-v2");
+    case TargetIsa::X86_64_V3: return(L"x86-64-v3");
+    case TargetIsa::X86_64_V4: return(L"x86-64-v4");
+    case TargetIsa::ARMV8_2: return(L"armv8.2");
+    default: throw;
+  }
+}
+
+static inline wstring toolchainName(const Toolchain toolchain)
+{
+  switch (toolchain)
+  {
+    case Toolchain::MSVC: return(L"MSVC");
+    case Toolchain::ClangCL: return(L"CLANG_CL");
+    case Toolchain::GNU: return(L"GNU");
+    default: throw;
+  }
+}
+
+static inline wstring toolchainCondition(const Toolchain toolchain,const wstring &value)
+{
+  return(L"$<$<STREQUAL:${MAGICK_TOOLCHAIN}," + toolchainName(toolchain) + L">:" + value + L">");
+}
+
+static inline wstring toolchainOption(const wstring &msvc,const wstring &clangCl,const wstring &gnu)
+{
+  wstring
+    result;
+
+  if ((msvc == clangCl) && (!msvc.empty()))
+    result=L"$<$<NOT:$<STREQUAL:${MAGICK_TOOLCHAIN}," + toolchainName(Toolchain::GNU) + L">>:" + msvc + L">";
+  else
+  {
+    if (!msvc.empty())
+      result=toolchainCondition(Toolchain::MSVC,msvc);
+    if (!clangCl.empty())
+      result+=(result.empty() ? L"" : L" ") + toolchainCondition(Toolchain::ClangCL,clangCl);
+  }
+  if (!gnu.empty())
+    result+=(result.empty() ? L"" : L" ") + toolchainCondition(Toolchain::GNU,gnu);
+  return(result);
+}
+
+static inline wstring sourceIsaOption(const wstring &isa)
+{
+  /* MSVC accepts the intrinsics without a switch except for the VEX encoded instructions */
+  /* The baseline undoes the ISA level of the target for the code that checks the processor */
+  if (isa == L"baseline")
+    return(toolchainOption(L"/arch:SSE2",L"/clang:-march=x86-64",L"-march=x86-64"));
+  else if (isa == L"sse2")
+    return(toolchainOption(L"",L"-msse2",L"-msse2"));
+  else if (isa == L"sse3")
+    return(toolchainOption(L"",L"-msse3",L"-msse3"));
+  else if (isa == L"ssse3")
+    return(toolchainOption(L"",L"-mssse3",L"-mssse3"));
+  else if (isa == L"sse4.1")
+    return(toolchainOption(L"",L"-msse4.1",L"-msse4.1"));
+  else if (isa == L"sse4.2")
+    return(toolchainOption(L"",L"-msse4.2",L"-msse4.2"));
+  else if (isa == L"avx")
+    return(toolchainOption(L"/arch:AVX",L"-mavx",L"-mavx"));
+  else if (isa == L"avx2")
+    return(toolchainOption(L"/arch:AVX2",L"-mavx2",L"-mavx2") + L" " + toolchainOption(L"",L"-mfma",L"-mfma"));
+  else if (isa == L"arm_crc32")
+    return(toolchainOption(L"",L"/clang:-march=armv8-a+crc",L"-march=armv8-a+crc"));
+  else if (isa == L"neon_dotprod")
+    return(toolchainOption(L"",L"/clang:-march=armv8.2-a+dotprod",L"-march=armv8.2-a+dotprod"));
+  else if (isa == L"neon_i8mm")
+    return(toolchainOption(L"",L"/clang:-march=armv8.2-a+dotprod+i8mm",L"-march=armv8.2-a+dotprod+i8mm"));
+
+  throwException(L"Unknown source isa: " + isa);
+  return(L"");
+}
+
+static const unsigned long long fnv1aBasis=14695981039346656037ULL;
+
+static inline unsigned long long fnv1a(unsigned long long hash,const void *data,const size_t length)
+{
+  const unsigned char
+    *p;
+
+  p=(const unsigned char *) data;
+  for (size_t i=0; i < length; i++)
+  {
+    hash^=p[i];
+    hash*=1099511628211ULL;
+  }
+  return(hash);
+}
+
+static inline unsigned long long fnv1a(unsigned long long hash,const wstring &value)
+{
+  /* The terminator keeps "ab","c" and "a","bc" apart */
+  return(fnv1a(hash,value.c_str(),(value.length()+1)*sizeof(wchar_t)));
+}
+
+static inline unsigned long long fnv1aFile(unsigned long long hash,const wstring &fileName)
+{
+  char
+    buffer[65536];
+
+  ifstream
+    file;
+
+  file.open(fileName,ios::binary);
+  if (!file)
+    return(fnv1a(hash,L"<missing>"));
+
+  while (file.read(buffer,sizeof(buffer)) || file.gcount() > 0)
+    hash=fnv1a(hash,buffer,(size_t) file.gcount());
+
+  file.close();
+  return(hash);
+}
+
+static inline bool isValidSrcFile(const wstring &fileName)
+{
+  foreach_const(wstring,ext,validSrcFiles)
+  {
+    if (endsWith(fileName,*ext))
+      return(true);
+  }
+
+  return(false);
+}
+
+#endif // __Shared__
@@ -1,603 +1,1563 @@
-/*
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-%                                                                             %
-%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
-%  dedicated to making software imaging solutions freely available.           %
-%                                                                             %
-%  You may not use this file except in compliance with the License.  You may  %
-%  obtain a copy of the License at                                            %
-%                                                                             %
-%    http://www.imagemagick.org/script/license.php                            %
-%                                                                             %
-%  Unless required by applicable law or agreed to in writing, software        %
-%  distributed under the License is distributed on an "AS IS" BASIS,          %
-%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
-%  See the License for the specific language governing permissions and        %
-%  limitations under the License.                                             %
-%                                                                             %
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-*/
-#include "stdafx.h"
-#include "Solution.h"
-#include "Shared.h"
-#include "VersionInfo.h"
-
-Solution::Solution()
-{
-}
-
-int Solution::loadProjectFiles(const ConfigureWizard &wizard)
-{
-  int
-    count;
-
-  count=0;
-  foreach (Project*,p,_projects)
-  {
-    if (!(*p)->isSupported(wizard.visualStudioVersion()))
-      continue;
-
-    if (!(*p)->loadFiles(wizard))
-      continue;
-
-    foreach (ProjectFile*,pf,(*p)->files())
-    {
-      (*pf)->loadConfig();
-      count++;
-    }
-
-    (*p)->checkFiles(wizard.visualStudioVersion());
-
-    (*p)->mergeProjectFiles(wizard);
-  }
-
-  return(count);
-}
-
-void Solution::loadProjects()
-{
-  HANDLE
-    fileHandle;
-
-  WIN32_FIND_DATA
-    data;
-
-  fileHandle=FindFirstFile(L"..\\*.*",&data);
-  do
-  {
-    if (fileHandle == INVALID_HANDLE_VALUE)
-      return;
-
-    if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != FILE_ATTRIBUTE_DIRECTORY)
-      continue;
-
-    if (_wcsicmp(data.cFileName,L".") == 0)
-      continue;
-
-    if (_wcsicmp(data.cFileName,L"..") == 0)
-      continue;
-
-     Project* project = Project::create(data.cFileName);
-     if (project != (Project *) NULL)
-       _projects.push_back(project);
-  } while (FindNextFile(fileHandle,&data));
-
-  FindClose(fileHandle);
-}
-
-void Solution::write(const ConfigureWizard &wizard,WaitDialog &waitDialog)
-{
-  int
-    steps;
-
-  VersionInfo
-    versionInfo;
-
-  wofstream
-    file;
-
-  steps=loadProjectFiles(wizard);
-  /* write solution, configuration, MakeFile.PL and version */
-  waitDialog.setSteps(steps+4);
-
-  file.open(getFileName(wizard));
-  if (!file)
-    return;
-
-  waitDialog.nextStep(L"Writing solution");
-
-  write(wizard,file);
-
-  file.close();
-
-  foreach (Project*,p,_projects)
-  {
-    foreach (ProjectFile*,pf,(*p)->files())
-    {
-      if ((*pf)->prefix().compare(L"CORE") == 0)
-      {
-        waitDialog.nextStep(L"Writing: " + (*pf)->fileName());
-        (*pf)->write(_projects);
-      }
-    }
-  }
-
-  waitDialog.nextStep(L"Writing configuration");
-  writeMagickBaseConfig(wizard);
-
-  waitDialog.nextStep(L"Writing threshold-map.h");
-  writeThresholdMap(wizard);
-
-  //waitDialog.nextStep(L"Writing Makefile.PL");
-  //writeMakeFile(wizard);
-
-  waitDialog.nextStep(L"Writing policy config");
-  writePolicyConfig(wizard);
-
-  if (!versionInfo.load())
-    return;
-
-  waitDialog.nextStep(L"Writing version");
-  writeVersion(wizard,versionInfo);
-
-  //waitDialog.nextStep(L"Writing NOTICE.txt");
-  //writeNotice(wizard,versionInfo);
-}
-
-wstring Solution::getFileName(const ConfigureWizard &wizard)
-{
-  wstring
-    fileName;
-
-  fileName = L"..\\CMakeLists.txt";
-
-  return(fileName);
-}
-
-wstring Solution::getFolder()
-{
-  wstring
-    folder;
-
-  folder=L"MagickCore";
-  if (!PathFileExists((L"..\\..\\ImageMagick\\" + folder).c_str()))
-    folder=L"magick";
-  return(folder);
-}
-
-bool Solution::isImageMagick7(const ConfigureWizard &wizard)
-{
-  foreach (Project*,p,_projects)
-  {
-    if ((*p)->name().compare(L"MagickCore") == 0)
-      return(true);
-  }
-    return(false);
-}
-
-void Solution::writeMagickBaseConfig(const ConfigureWizard &wizard)
-{
-  wstring
-    folder,
-    line;
-
-  wifstream
-    configIn;
-
-  wofstream
-    config;
-
-  folder=getFolder();
-
-  configIn.open(L"..\\" + folder + L"\\magick-baseconfig.h.in");
-  if (!configIn)
-    return;
-
-  config.open(L"..\\..\\ImageMagick\\" + folder + L"\\magick-baseconfig.h");
-  if (!config)
-    return;
-
-  while (getline(configIn,line))
-  {
-    if (trim(line).compare(L"$$CONFIG$$") != 0)
-    {
-      config << line << endl;
-      continue;
-    }
-
-    config << "/*" << endl;
-    config << "  Define to build a ImageMagick which uses registry settings or" << endl;
-    config << "  hard-coded paths to locate installed components.  This supports" << endl;
-    config << "  using the \"setup.exe\" style installer, or using hard-coded path" << endl;
-    config << "  definitions (see below).  If you want to be able to simply copy" << endl;
-    config << "  the built ImageMagick to any directory on any directory on any machine," << endl;
-    config << "  then do not use this setting." << endl;
-    config << "*/" << endl;
-    if (wizard.installedSupport())
-      config << "#define MAGICKCORE_INSTALLED_SUPPORT" << endl;
-    else
-      config << "#undef MAGICKCORE_INSTALLED_SUPPORT" << endl;
-    config << endl;
-
-    config << "/*" << endl;
-    config << "  Specify size of PixelPacket color Quantums (8, 16, or 32)." << endl;
-    config << "  A value of 8 uses half the memory than 16 and typically runs 30% faster," << endl;
-    config << "  but provides 256 times less color resolution than a value of 16." << endl;
-    config << "*/" << endl;
-    if (wizard.quantumDepth() == QuantumDepth::Q8)
-      config << "#define MAGICKCORE_QUANTUM_DEPTH 8" << endl;
-    else if (wizard.quantumDepth() == QuantumDepth::Q16)
-      config << "#define MAGICKCORE_QUANTUM_DEPTH 16" << endl;
-    else if (wizard.quantumDepth() == QuantumDepth::Q32)
-      config << "#define MAGICKCORE_QUANTUM_DEPTH 32" << endl;
-    else if (wizard.quantumDepth() == QuantumDepth::Q64)
-      config << "#define MAGICKCORE_QUANTUM_DEPTH 64" << endl;
-    config << endl;
-
-    if (isImageMagick7(wizard))
-      {
-        config << "/*" << endl;
-        config << "  Channel mask depth" << endl;
-        config << "*/" << endl;
-        config << "#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)" << endl;
-        config << "#ifdef _WIN64" << endl;
-        config << "#define MAGICKCORE_CHANNEL_MASK_DEPTH 64" << endl;
-        config << "#else" << endl;
-        config << "#define MAGICKCORE_CHANNEL_MASK_DEPTH 32" << endl;
-        config << "#endif" << endl;
-        config << "#else" << endl;
-        config << "#define MAGICKCORE_CHANNEL_MASK_DEPTH 32" << endl;
-        config << "#endif" << endl;
-        config << endl;
-      }
-
-    config << "/*" << endl;
-    config << "  Define to enable high dynamic range imagery (HDRI)" << endl;
-    config << "*/" << endl;
-    if (wizard.useHDRI())
-      config << "#define MAGICKCORE_HDRI_ENABLE 1" << endl;
-    else
-      config << "#define MAGICKCORE_HDRI_ENABLE 0" << endl;
-    config << endl;
-
-    config << "/*" << endl;
-    config << "  Define to enable OpenCL" << endl;
-    config << "*/" << endl;
-    if (wizard.useOpenCL())
-      config << "#define MAGICKCORE_HAVE_CL_CL_H" << endl;
-    else
-      config << "#undef MAGICKCORE_HAVE_CL_CL_H" << endl;
-    config << endl;
-
-    config << "/*" << endl;
-    config << "  Define to enable Distributed Pixel Cache" << endl;
-    config << "*/" << endl;
-    if (wizard.enableDpc())
-      config << "#define MAGICKCORE_DPC_SUPPORT" << endl;
-    else
-      config << "#undef MAGICKCORE_DPC_SUPPORT" << endl;
-    config << endl;
-
-    config << "/*" << endl;
-    config << "  Exclude deprecated methods in MagickCore API" << endl;
-    config << "*/" << endl;
-    if (wizard.excludeDeprecated())
-      config << "#define MAGICKCORE_EXCLUDE_DEPRECATED" << endl;
-    else
-      config << "#undef MAGICKCORE_EXCLUDE_DEPRECATED" << endl;
-    config << endl;
-
-    config << "/*" << endl;
-    config << "  Define to only use the built-in (in-memory) settings." << endl;
-    config << "*/" << endl;
-    if (wizard.zeroConfigurationSupport())
-      config << "#define MAGICKCORE_ZERO_CONFIGURATION_SUPPORT 1" << endl;
-    else
-      config << "#define MAGICKCORE_ZERO_CONFIGURATION_SUPPORT 0" << endl;
-
-    foreach (Project*,p,_projects)
-    {
-      if ((*p)->files().size() == 0)
-        continue;
-
-      if ((*p)->configDefine().empty())
-        continue;
-
-      config << endl;
-      config << (*p)->configDefine();
-    }
-  }
-}
-
-void Solution::writeMakeFile(const ConfigureWizard &wizard)
-{
-  wifstream
-    makeFileIn,
-    zipIn;
-
-  wofstream
-    lib,
-    makeFile,
-    zip;
-
-  wstring
-    libName,
-    line;
-
-  libName=L"CORE_RL_" + getFolder()+ L"_";
-
-  lib=wofstream(L"..\\..\\ImageMagick\\PerlMagick\\" + libName + L".a");
-  if (!lib)
-    return;
-  lib.close();
-
-  zipIn=wifstream(L"..\\PerlMagick\\Zip.ps1", std::ios::binary);
-  if (!zipIn)
-    return;
-  zip=wofstream(L"..\\..\\ImageMagick\\PerlMagick\\Zip.ps1", std::ios::binary);
-  zip << zipIn.rdbuf();
-  zip.close();
-
-  makeFileIn.open(L"..\\PerlMagick\\Makefile.PL.in");
-  if (!makeFileIn)
-    return;
-
-  makeFile.open(L"..\\..\\ImageMagick\\PerlMagick\\Makefile.PL");
-  if (!makeFile)
-    return;
-
-  while (getline(makeFileIn,line))
-  {
-    line=replace(line,L"$$LIB_NAME$$",libName);
-    line=replace(line,L"$$PLATFORM$$",wizard.platformAlias());
-    makeFile << line << endl;
-  }
-  makeFile.close();
-}
-
-void Solution::writeNotice(const ConfigureWizard &wizard,const VersionInfo &versionInfo)
-{
-  wofstream
-    notice;
-
-  notice.open(L"..\\..\\VisualMagick\\NOTICE.txt");
-  if (!notice)
-    return;
-
-  notice << "* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *" << endl << endl;
-  notice << "[ Imagemagick " << versionInfo.version() << versionInfo.libAddendum() << "] copyright:" << endl << endl;
-  notice << readLicense(L"..\\..\\ImageMagick\\LICENSE");
-  notice << endl << "* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *" << endl << endl;
-
-  foreach (Project*,p,_projects)
-  {
-    if (((*p)->notice() == L"") || (*p)->shouldSkip(wizard))
-      continue;
-
-    notice << (*p)->notice();
-    notice << "* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *" << endl << endl;
-  }
-
-  notice.close();
-}
-
-void Solution::writePolicyConfig(const ConfigureWizard &wizard)
-{
-  wchar_t
-    buffer[512];
-
-  wifstream
-    infile;
-
-  wofstream
-    outfile;
-
-  switch(wizard.policyConfig())
-  {
-  case PolicyConfig::LIMITED:
-    infile=wifstream(L"..\\..\\ImageMagick\\config\\policy-limited.xml");
-    break;
-  case PolicyConfig::OPEN:
-    infile=wifstream(L"..\\..\\ImageMagick\\config\\policy-open.xml");
-    break;
-  case PolicyConfig::SECURE:
-    infile=wifstream(L"..\\..\\ImageMagick\\config\\policy-secure.xml");
-    break;
-  case PolicyConfig::WEBSAFE:
-    infile=wifstream(L"..\\..\\ImageMagick\\config\\policy-websafe.xml");
-    break;
-  }
-  if (!infile)
-    throwException(L"Unable to open policy file");
-  outfile=wofstream(L"..\\bin\\policy.xml");
-  while (infile.read(buffer, 512))
-    outfile.write(buffer, infile.gcount());
-  outfile.write(buffer, infile.gcount());
-  infile.close();
-  outfile.close();
-}
-
-void Solution::writeThresholdMap(const ConfigureWizard &wizard)
-{
-  wifstream
-    inputStream;
-
-  wofstream
-    outputStream;
-
-  wstring
-    line;
-
-  if (!wizard.zeroConfigurationSupport())
-    return;
-
-  inputStream.open(L"..\\bin\\thresholds.xml");
-  if (!inputStream)
-    return;
-
-  outputStream.open(L"..\\..\\ImageMagick\\MagickCore\\threshold-map.h");
-  if (!outputStream)
-    {
-      inputStream.close();
-      return;
-    }
-
-  outputStream << "static const char *const BuiltinMap=" << endl;
-
-  while (getline(inputStream,line))
-  {
-    if (line.length() == 0)
-      continue;
-
-    line=replace(line,L"\"",L"\\\"");
-    outputStream << "\"" << line << "\"" << endl;
-  }
-
-  outputStream << ";";
-
-  inputStream.close();
-  outputStream.close();
-}
-
-void Solution::writeVersion(const ConfigureWizard &wizard,const VersionInfo &versionInfo)
-{
-
-  wstring
-    folder,
-    line;
-
-  folder=getFolder();
-
-  writeVersion(wizard,versionInfo,L"..\\..\\ImageMagick\\"+folder+L"\\version.h.in",L"..\\..\\ImageMagick\\"+folder+L"\\version.h");
-  writeVersion(wizard,versionInfo,L"..\\..\\ImageMagick\\config\\configure.xml.in",L"..\\bin\\configure.xml");
-  writeVersion(wizard,versionInfo,L"..\\installer\\inc\\version.isx.in",L"..\\installer\\inc\\version.isx");
-  writeVersion(wizard,versionInfo,L"..\\utilities\\ImageMagick.version.h.in",L"..\\utilities\\ImageMagick.version.h");
-}
-
-void Solution::writeVersion(const ConfigureWizard &wizard,const VersionInfo &versionInfo,wstring input,wstring output)
-{
-  size_t
-    start,
-    end;
-
-  wifstream
-    inputStream;
-
-  wofstream
-    outputStream;
-
-  wstring
-    line;
-
-  inputStream.open(input);
-  if (!inputStream)
-    return;
-
-  outputStream.open(output);
-  if (!outputStream)
-    {
-      inputStream.close();
-      return;
-    }
-
-  while (getline(inputStream,line))
-  {
-    line=replace(line,L"@CC@",wizard.visualStudioVersionName());
-    line=replace(line,L"@CHANNEL_MASK_DEPTH@",wizard.channelMaskDepth());
-    line=replace(line,L"@CXX@",wizard.visualStudioVersionName());
-    line=replace(line,L"@DOCUMENTATION_PATH@",L"unavailable");
-    line=replace(line,L"@LIB_VERSION@",versionInfo.version());
-    line=replace(line,L"@MAGICK_GIT_REVISION@",versionInfo.gitRevision());
-    line=replace(line,L"@MAGICK_LIB_VERSION_NUMBER@",versionInfo.libVersionNumber());
-    line=replace(line,L"@MAGICK_LIB_VERSION_TEXT@",versionInfo.version());
-    line=replace(line,L"@MAGICK_LIBRARY_CURRENT@",versionInfo.interfaceVersion());
-    line=replace(line,L"@MAGICK_LIBRARY_CURRENT_MIN@",versionInfo.interfaceVersion());
-    line=replace(line,L"@MAGICK_TARGET_CPU@",wizard.platformAlias());
-    line=replace(line,L"@MAGICK_TARGET_OS@",L"Windows");
-    line=replace(line,L"@MAGICKPP_LIB_VERSION_TEXT@",versionInfo.version());
-    line=replace(line,L"@MAGICKPP_LIBRARY_CURRENT@",versionInfo.ppInterfaceVersion());
-    line=replace(line,L"@MAGICKPP_LIBRARY_CURRENT_MIN@",versionInfo.ppInterfaceVersion());
-    line=replace(line,L"@MAGICKPP_LIBRARY_VERSION_INFO@",versionInfo.ppLibVersionNumber());
-    line=replace(line,L"@MAGICKPP_LIBRARY_VERSION_TEXT@",versionInfo.version());
-    line=replace(line,L"@PACKAGE_BASE_VERSION@",versionInfo.version());
-    line=replace(line,L"@PACKAGE_FULL_VERSION@",versionInfo.fullVersion());
-    line=replace(line,L"@PACKAGE_LIB_VERSION@",versionInfo.libVersion());
-    line=replace(line,L"@PACKAGE_LIB_VERSION_NUMBER@",versionInfo.versionNumber());
-    line=replace(line,L"@PACKAGE_NAME@",L"ImageMagick");
-    line=replace(line,L"@PACKAGE_VERSION_ADDENDUM@",versionInfo.libAddendum());
-    line=replace(line,L"@PACKAGE_RELEASE_DATE@",versionInfo.releaseDate());
-    line=replace(line,L"@QUANTUM_DEPTH@",to_wstring((int) wizard.quantumDepth()));
-    line=replace(line,L"@RELEASE_DATE@",versionInfo.releaseDate());
-    line=replace(line,L"@TARGET_OS@",L"Windows");
-    start=line.find(L"@");
-    if (start != string::npos)
-    {
-      end=line.find(L"@",start+1);
-      if (end != string::npos)
-        checkKeyword(line.substr(start+1,end-start-1));
-      continue;
-    }
-    outputStream << line << endl;
-  }
-
-  inputStream.close();
-  outputStream.close();
-}
-
-void Solution::checkKeyword(const wstring keyword)
-{
-  vector<wstring> skipableKeywords={
-    L"CODER_PATH",L"CONFIGURE_ARGS",L"CONFIGURE_PATH",L"CXXFLAGS",L"DEFS",L"DISTCHECK_CONFIG_FLAGS",
-    L"EXEC_PREFIX_DIR",L"EXECUTABLE_PATH",L"FILTER_PATH",L"host",L"INCLUDE_PATH",L"LIBRARY_PATH",
-    L"MAGICK_CFLAGS",L"MAGICK_CPPFLAGS",L"MAGICK_DELEGATES",L"MAGICK_FEATURES",L"MAGICK_LDFLAGS",
-    L"MAGICK_LIBS",L"MAGICK_PCFLAGS",L"MAGICK_SECURITY_POLICY",L"MAGICK_TARGET_VENDOR",L"PREFIX_DIR",
-    L"SHARE_PATH",L"SHAREARCH_PATH"
-  };
-
-  if (contains(skipableKeywords,keyword))
-    return;
-
-  throwException(L"Invalid keyword: " + keyword);
-}
-
-void Solution::write(const ConfigureWizard &wizard,wofstream &file)
-{
-  file << "cmake_minimum_required(VERSION " << wizard.cmakeMinVersion() << ")" << endl;
-  file << "project(Visual" << wizard.solutionName() << " LANGUAGES C CXX ASM" << ")" << endl;
-
-  file << "set(CMAKE_CXX_STANDARD 17)" << endl;
-  file << "set(CMAKE_CXX_STANDARD_REQUIRED ON)" << endl;
-
-  file << "set(CMAKE_C_STANDARD 17)" << endl;
-  file << "set(CMAKE_C_STANDARD_REQUIRED ON)" << endl;
-
-  file << "set(CMAKE_LIBRARY_OUTPUT_DIRECTORY \"" << wizard.libDirectory() << "\")" << endl;
-  file << "set(CMAKE_RUNTIME_OUTPUT_DIRECTORY \"" << wizard.binDirectory() << "\")" << endl;
-  file << "set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY \"" << wizard.libDirectory() << "\")" << endl;
-
-  file << "link_directories(\"" << wizard.libDirectory() << "\")" << endl;
-
-  switch (wizard.solutionType())
-  {
-  case SolutionType::STATIC_MTD:
-  case SolutionType::DYNAMIC_MT:
-    file << "set(CMAKE_MSVC_RUNTIME_LIBRARY \"MultiThreaded$<$<CONFIG:Debug>:Debug>DLL\")" << endl;
-    break;
-  case SolutionType::STATIC_MT:
-    file << "set(CMAKE_MSVC_RUNTIME_LIBRARY \"MultiThreaded$<$<CONFIG:Debug>:Debug>\")" << endl;
-    break;
-  default:
-    break;
-  }
-
-  for (const auto& p : _projects)
-  {
-    for (const auto& pf : p->files())
-    {
-      if (pf->prefix().compare(L"CORE") == 0)
-      {
-        file << "add_subdirectory(VisualStudioProjects/" << pf->name() << ")" << endl;
-      }
-    }
-  }
-}
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "stdafx.h"
+#include "Solution.h"
+#include "Shared.h"
+#include "VersionInfo.h"
+#include <map>
+
+/* Increase when the output of writeDelegates changes, it is written after the fingerprint */
+static const wchar_t
+  *delegatesGeneratorVersion=L"1";
+
+/* The estimated memory in MB of a compile job */
+static const size_t
+  compileJobMemory=256;
+
+/* The estimated memory in MB of a link, without and for each object */
+static const size_t
+  linkBaseMemory=128,
+  linkObjectMemory=1;
+
+/* A link is heavy when it has at least a quarter of the objects of the largest link */
+static const size_t
+  heavyLinkRatio=4;
+
+Solution::Solution()
+{
+  _heavyLinkMemory=0;
+  _linkMemory=0;
+}
+
+int Solution::loadProjectFiles(const ConfigureWizard &wizard)
+{
+  int
+    count;
+
+  if (!wizard.formats().empty())
+    selectFormats(wizard);
+
+  count=0;
+  foreach (Project*,p,_projects)
+  {
+    if (!(*p)->isSupported(wizard.visualStudioVersion()))
+      continue;
+
+    /* The coders were already loaded to select the formats */
+    if (!wizard.formats().empty() && (*p)->name() == L"coders")
+      (*p)->removeFiles(_coderModules);
+    else
+    {
+      if (!(*p)->loadFiles(wizard))
+        continue;
+
+      foreach (ProjectFile*,pf,(*p)->files())
+      {
+        (*pf)->loadConfig();
+      }
+    }
+
+    (*p)->checkFiles(wizard.visualStudioVersion());
+
+    (*p)->mergeProjectFiles(wizard);
+
+    if ((*p)->isMagickProject())
+      (*p)->createVariants(wizard);
+
+    if (wizard.avx2Modules())
+      (*p)->createIsaModules(wizard);
+
+    count+=(int) (*p)->files().size();
+  }
+
+  return(count);
+}
+
+void Solution::loadProjects()
+{
+  HANDLE
+    fileHandle;
+
+  WIN32_FIND_DATA
+    data;
+
+  fileHandle=FindFirstFile(L"..\\*.*",&data);
+  do
+  {
+    if (fileHandle == INVALID_HANDLE_VALUE)
+      return;
+
+    if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != FILE_ATTRIBUTE_DIRECTORY)
+      continue;
+
+    if (_wcsicmp(data.cFileName,L".") == 0)
+      continue;
+
+    if (_wcsicmp(data.cFileName,L"..") == 0)
+      continue;
+
+     Project* project = Project::create(data.cFileName);
+     if (project != (Project *) NULL)
+       _projects.push_back(project);
+  } while (FindNextFile(fileHandle,&data));
+
+  FindClose(fileHandle);
+}
+
+void Solution::write(const ConfigureWizard &wizard,WaitDialog &waitDialog)
+{
+  bool
+    useHDRI;
+
+  int
+    steps;
+
+  QuantumDepth
+    quantumDepth;
+
+  VersionInfo
+    versionInfo;
+
+  wofstream
+    file;
+
+  if ((wizard.targetIsa() != TargetIsa::BASELINE) && ((wizard.targetIsa() == TargetIsa::ARMV8_2) != (wizard.platform() == Platform::ARM64)))
+    throwException(L"The ISA level " + wizard.targetIsaName() + L" is not supported on " + wizard.platformName());
+
+  if (wizard.avx2Modules() && ((wizard.platform() == Platform::ARM64) || (wizard.targetIsa() != TargetIsa::BASELINE && wizard.targetIsa() != TargetIsa::X86_64_V2)))
+    throwException(L"The AVX2 modules require an x86 or x64 build with a baseline ISA level");
+
+  /* The Linux modules are library outputs and the selection of the AVX2 directory is only written for MSVC */
+  if (wizard.avx2Modules() && wizard.targetLinux())
+    throwException(L"The AVX2 modules are not supported on Linux");
+
+  /* The static registration of MagickCore references the Register method of every coder */
+  if (!wizard.formats().empty() && wizard.solutionType() != SolutionType::DYNAMIC_MT)
+    throwException(L"The format list (/formats) is only supported by the dynamic build (/dmt)");
+
+  /* The variants are checked before any of the projects is written */
+  foreach_const (wstring,variant,wizard.variants())
+  {
+    parseVariant(*variant,quantumDepth,useHDRI);
+  }
+
+  /* The module loader of MagickCore does not read module-shards.h yet */
+  if (wizard.moduleShards() > 0)
+    throwException(L"The module shards (/moduleShards) are not supported by the module loader of MagickCore");
+
+  steps=loadProjectFiles(wizard);
+  /* write solution, configuration, MakeFile.PL and version */
+  waitDialog.setSteps(steps+7);
+
+  foreach (Project*,p,_projects)
+  {
+    foreach (ProjectFile*,pf,(*p)->files())
+    {
+      if (isWritten(wizard,*pf))
+        (*pf)->loadSource();
+    }
+  }
+
+  if (wizard.objectLibraries())
+    assignObjectLibraries(wizard);
+
+  if (wizard.memoryBudget() > 0)
+    assignJobPools(wizard);
+
+  /* The projects are written first because the fingerprint of the delegates uses their sources */
+  foreach (Project*,p,_projects)
+  {
+    foreach (ProjectFile*,pf,(*p)->files())
+    {
+      if (isWritten(wizard,*pf))
+      {
+        waitDialog.nextStep(L"Writing: " + (*pf)->fileName());
+        (*pf)->write(_projects);
+      }
+    }
+  }
+
+  file.open(getFileName(wizard));
+  if (!file)
+    return;
+
+  waitDialog.nextStep(L"Writing solution");
+
+  write(wizard,file);
+
+  file.close();
+
+  waitDialog.nextStep(L"Writing delegates");
+  writeDelegates(wizard);
+
+  waitDialog.nextStep(L"Writing configuration");
+  writeMagickBaseConfig(wizard);
+
+  waitDialog.nextStep(L"Writing threshold-map.h");
+  writeThresholdMap(wizard);
+
+  waitDialog.nextStep(L"Writing static-modules.h");
+  writeStaticModules(wizard);
+
+  waitDialog.nextStep(L"Writing module-shards.h");
+  writeModuleShards(wizard);
+
+  //waitDialog.nextStep(L"Writing Makefile.PL");
+  //writeMakeFile(wizard);
+
+  waitDialog.nextStep(L"Writing policy config");
+  writePolicyConfig(wizard);
+
+  if (!versionInfo.load())
+    return;
+
+  waitDialog.nextStep(L"Writing version");
+  writeVersion(wizard,versionInfo);
+
+  //waitDialog.nextStep(L"Writing NOTICE.txt");
+  //writeNotice(wizard,versionInfo);
+}
+
+void Solution::collectObjectLibraries(ProjectFile *projectFile,vector<ProjectFile*> &objectLibraries)
+{
+  vector<ProjectFile*>
+    dependencies;
+
+  dependencies=projectFile->dependencyFiles(_projects);
+  foreach (ProjectFile*,dependency,dependencies)
+  {
+    if (!(*dependency)->isObjectLibrary())
+      continue;
+
+    if (find(objectLibraries.begin(),objectLibraries.end(),*dependency) != objectLibraries.end())
+      continue;
+
+    objectLibraries.push_back(*dependency);
+    collectObjectLibraries(*dependency,objectLibraries);
+  }
+}
+
+wstring Solution::delegatesFingerprint(const ConfigureWizard &wizard)
+{
+  unsigned long long
+    hash;
+
+  wchar_t
+    buffer[17];
+
+  hash=fnv1aBasis;
+  hash=fnv1a(hash,delegatesGeneratorVersion);
+  hash=fnv1a(hash,wizard.cmakeMinVersion());
+  hash=fnv1a(hash,wizard.platformName());
+  hash=fnv1a(hash,wizard.visualStudioVersionName());
+  hash=fnv1a(hash,to_wstring((int) wizard.solutionType()));
+  hash=fnv1a(hash,wizard.targetLinux() ? L"linux" : L"windows");
+  hash=fnv1a(hash,wizard.useOpenMP() ? L"openmp" : L"");
+  hash=fnv1a(hash,wizard.cacheableDebugInfo() ? L"embedded" : L"");
+  hash=fnv1a(hash,wizard.includeIncompatibleLicense() ? L"incompatible" : L"");
+  /* The ISA level is added to the compile options of every delegate */
+  hash=fnv1a(hash,wizard.targetIsaName());
+
+  foreach (Project*,p,_projects)
+  {
+    if ((*p)->isMagickProject() || (*p)->files().empty())
+      continue;
+
+    hash=fnv1a(hash,(*p)->name());
+    hash=fnv1aFile(hash,L"..\\" + (*p)->name() + L"\\Config.txt");
+    foreach (ProjectFile*,pf,(*p)->files())
+    {
+      if (isWritten(wizard,*pf))
+        hash=(*pf)->fingerprint(hash);
+    }
+  }
+
+  swprintf_s(buffer,L"%016llx",hash);
+  return(buffer);
+}
+
+wstring Solution::getFileName(const ConfigureWizard &wizard)
+{
+  wstring
+    fileName;
+
+  fileName = L"..\\CMakeLists.txt";
+
+  return(fileName);
+}
+
+wstring Solution::getFolder()
+{
+  wstring
+    folder;
+
+  folder=L"MagickCore";
+  if (!PathFileExists((L"..\\..\\ImageMagick\\" + folder).c_str()))
+    folder=L"magick";
+  return(folder);
+}
+
+Project *Solution::findProject(const wstring &name)
+{
+  foreach (Project*,p,_projects)
+  {
+    if ((*p)->name() == name)
+      return(*p);
+  }
+  return((Project *) NULL);
+}
+
+void Solution::parseVariant(const wstring &variant,QuantumDepth &quantumDepth,bool &useHDRI)
+{
+  wstring
+    depth;
+
+  useHDRI=endsWith(variant,L"HDRI");
+  depth=useHDRI ? variant.substr(0,variant.length()-4) : variant;
+  if (depth == L"Q8")
+    quantumDepth=QuantumDepth::Q8;
+  else if (depth == L"Q16")
+    quantumDepth=QuantumDepth::Q16;
+  else if (depth == L"Q32")
+    quantumDepth=QuantumDepth::Q32;
+  else if (depth == L"Q64")
+    quantumDepth=QuantumDepth::Q64;
+  else
+    throwException(L"Invalid variant: " + variant);
+}
+
+wstring Solution::targetIsaOption(const ConfigureWizard &wizard)
+{
+  /* The supported versions of the MSVC compiler have no switch for the SSE4.2 level */
+  switch (wizard.targetIsa())
+  {
+    case TargetIsa::X86_64_V2: return(toolchainOption(L"",L"/clang:-march=x86-64-v2",L"-march=x86-64-v2"));
+    case TargetIsa::X86_64_V3: return(toolchainOption(L"/arch:AVX2",L"/clang:-march=x86-64-v3",L"-march=x86-64-v3"));
+    case TargetIsa::X86_64_V4: return(toolchainOption(L"/arch:AVX512",L"/clang:-march=x86-64-v4",L"-march=x86-64-v4"));
+    case TargetIsa::ARMV8_2: return(toolchainOption(L"/arch:armv8.2",L"/clang:-march=armv8.2-a",L"-march=armv8.2-a"));
+    default: return(L"");
+  }
+}
+
+bool Solution::isImageMagick7(const ConfigureWizard &wizard)
+{
+  foreach (Project*,p,_projects)
+  {
+    if ((*p)->name().compare(L"MagickCore") == 0)
+      return(true);
+  }
+    return(false);
+}
+
+void Solution::selectFormats(const ConfigureWizard &wizard)
+{
+  bool
+    found;
+
+  Project
+    *coders,
+    *project;
+
+  size_t
+    index;
+
+  vector<wstring>
+    dependencies,
+    projects;
+
+  wstring
+    dependency,
+    moduleName,
+    projectName;
+
+  coders=findProject(L"coders");
+  if ((coders == (Project *) NULL) || (!coders->loadFiles(wizard)))
+    throwException(L"Unable to select the formats without the coders project");
+
+  foreach (ProjectFile*,pf,coders->files())
+  {
+    (*pf)->loadConfig();
+  }
+
+  _coderModules.clear();
+  foreach_const (wstring,format,wizard.formats())
+  {
+    found=false;
+    foreach (ProjectFile*,pf,coders->files())
+    {
+      if (!(*pf)->isFormat(*format))
+        continue;
+
+      found=true;
+      if (!contains(_coderModules,(*pf)->moduleName()))
+      {
+        _coderModules.push_back((*pf)->moduleName());
+        dependencies.insert(dependencies.end(),(*pf)->dependencies().begin(),(*pf)->dependencies().end());
+      }
+    }
+    if (!found)
+      throwException(L"Unknown format: " + *format);
+  }
+
+  /* Only the libraries, the coders and the filters are built, the delegates only when they are used */
+  dependencies.push_back(L"MagickCore");
+  dependencies.push_back(L"MagickWand");
+  dependencies.push_back(L"Magick++");
+  dependencies.push_back(L"coders");
+  dependencies.push_back(L"filters");
+
+  while (!dependencies.empty())
+  {
+    dependency=dependencies.back();
+    dependencies.pop_back();
+
+    projectName=dependency;
+    moduleName=L"";
+    index=dependency.find(L">");
+    if (index != -1)
+    {
+      projectName=dependency.substr(0,index);
+      moduleName=dependency.substr(index+1);
+    }
+
+    if ((projectName == L"coders") && (!moduleName.empty()) && (!contains(_coderModules,moduleName)))
+    {
+      _coderModules.push_back(moduleName);
+      foreach (ProjectFile*,pf,coders->files())
+      {
+        if ((*pf)->moduleName() == moduleName)
+          dependencies.insert(dependencies.end(),(*pf)->dependencies().begin(),(*pf)->dependencies().end());
+      }
+    }
+
+    if (contains(projects,projectName))
+      continue;
+
+    projects.push_back(projectName);
+    project=findProject(projectName);
+    if (project != (Project *) NULL)
+      dependencies.insert(dependencies.end(),project->dependencies().begin(),project->dependencies().end());
+  }
+
+  foreach (Project*,p,_projects)
+  {
+    if (!contains(projects,(*p)->name()))
+      (*p)->exclude();
+  }
+}
+
+void Solution::writeInterfaceLibraries(const ConfigureWizard &wizard,wofstream &file)
+{
+  file << "add_library(magick_common INTERFACE)" << endl;
+  file << "target_compile_definitions(magick_common INTERFACE";
+  file << "\n" << "  $<$<CONFIG:Debug>:_DEBUG>";
+  file << "\n" << "  $<$<CONFIG:Release>:NDEBUG>";
+  file << "\n" << "  $<$<PLATFORM_ID:Windows>:_WINDOWS>";
+  file << "\n" << "  $<$<PLATFORM_ID:Windows>:WIN32>";
+  file << "\n" << "  " << toolchainOption(L"_VISUALC_",L"_VISUALC_",L"");
+  file << "\n" << "  NeedFunctionPrototypes";
+  if (wizard.solutionType() != SolutionType::STATIC_MT && !wizard.targetLinux())
+    file << "\n" << "  $<$<STREQUAL:$<TARGET_PROPERTY:TYPE>,EXECUTABLE>:_AFXDLL>";
+  if (wizard.includeIncompatibleLicense())
+    file << "\n" << "  _MAGICK_INCOMPATIBLE_LICENSES_";
+  file << "\n)" << endl;
+
+  file << "target_compile_options(magick_common INTERFACE";
+  /* The debug information format is set by CMAKE_MSVC_DEBUG_INFORMATION_FORMAT in cacheable mode */
+  if (wizard.cacheableDebugInfo())
+    file << "\n" << "  " << toolchainOption(L"",L"",L"-g");
+  else
+    file << "\n" << "  " << toolchainOption(L"/Zi",L"/Zi",L"-g");
+  if (wizard.useOpenMP())
+    file << "\n" << "  " << toolchainOption(L"/openmp",L"/openmp",L"-fopenmp");
+  file << "\n" << "  " << toolchainOption(L"/FC",L"",L"");
+  file << "\n" << "  " << toolchainOption(L"/source-charset:utf-8",L"/source-charset:utf-8",L"-finput-charset=UTF-8");
+  if (wizard.targetIsa() != TargetIsa::BASELINE)
+    file << "\n" << "  " << targetIsaOption(wizard);
+  file << "\n)" << endl;
+
+  if (wizard.useOpenMP())
+    file << "target_link_options(magick_common INTERFACE " << toolchainOption(L"",L"",L"-fopenmp") << ")" << endl;
+
+  file << "add_library(magick_lib INTERFACE)" << endl;
+  file << "target_compile_definitions(magick_lib INTERFACE _LIB)" << endl;
+  file << "target_link_libraries(magick_lib INTERFACE magick_common)" << endl;
+
+  file << "add_library(magick_dll INTERFACE)" << endl;
+  file << "target_compile_definitions(magick_dll INTERFACE _DLL _MAGICKMOD_)" << endl;
+  file << "target_link_libraries(magick_dll INTERFACE magick_common)" << endl;
+}
+
+void Solution::writeJobPools(const ConfigureWizard &wizard,wofstream &file)
+{
+  if (wizard.memoryBudget() <= 0)
+    return;
+
+  /*
+    The compile jobs run next to the links so they get the budget that remains
+    after one heavy and one normal link, with at most one job per core.  The
+    heavy links get the budget that remains after the compile jobs and one
+    normal link and the other links use the rest.
+  */
+  file << "set(MAGICK_MEMORY_BUDGET " << wizard.memoryBudget() << " CACHE STRING \"Memory budget in MB of the compile and link jobs\")" << endl;
+  file << "if(MAGICK_MEMORY_BUDGET LESS " << compileJobMemory + _heavyLinkMemory + _linkMemory << ")" << endl;
+  file << "  message(WARNING \"The memory budget of ${MAGICK_MEMORY_BUDGET} MB is less than the " << compileJobMemory + _heavyLinkMemory + _linkMemory << " MB of one compile, one heavy and one normal link\")" << endl;
+  file << "endif()" << endl;
+  file << "cmake_host_system_information(RESULT MAGICK_COMPILE_JOBS QUERY NUMBER_OF_LOGICAL_CORES)" << endl;
+  file << "math(EXPR MAGICK_COMPILE_BUDGET_JOBS \"(${MAGICK_MEMORY_BUDGET} - " << _heavyLinkMemory + _linkMemory << ") / " << compileJobMemory << "\")" << endl;
+  file << "if(MAGICK_COMPILE_BUDGET_JOBS LESS MAGICK_COMPILE_JOBS)" << endl;
+  file << "  set(MAGICK_COMPILE_JOBS ${MAGICK_COMPILE_BUDGET_JOBS})" << endl;
+  file << "endif()" << endl;
+  file << "if(MAGICK_COMPILE_JOBS LESS 1)" << endl;
+  file << "  set(MAGICK_COMPILE_JOBS 1)" << endl;
+  file << "endif()" << endl;
+  file << "math(EXPR MAGICK_LINK_BUDGET \"${MAGICK_MEMORY_BUDGET} - ${MAGICK_COMPILE_JOBS} * " << compileJobMemory << "\")" << endl;
+  file << "math(EXPR MAGICK_HEAVY_LINK_JOBS \"(${MAGICK_LINK_BUDGET} - " << _linkMemory << ") / " << max(_heavyLinkMemory,(size_t) 1) << "\")" << endl;
+  file << "if(MAGICK_HEAVY_LINK_JOBS LESS 1)" << endl;
+  file << "  set(MAGICK_HEAVY_LINK_JOBS 1)" << endl;
+  file << "endif()" << endl;
+  file << "math(EXPR MAGICK_LINK_JOBS \"(${MAGICK_LINK_BUDGET} - ${MAGICK_HEAVY_LINK_JOBS} * " << _heavyLinkMemory << ") / " << max(_linkMemory,(size_t) 1) << "\")" << endl;
+  file << "if(MAGICK_LINK_JOBS LESS 1)" << endl;
+  file << "  set(MAGICK_LINK_JOBS 1)" << endl;
+  file << "endif()" << endl;
+  file << "set_property(GLOBAL APPEND PROPERTY JOB_POOLS" << endl;
+  file << "  magick_compile=${MAGICK_COMPILE_JOBS}" << endl;
+  file << "  magick_link=${MAGICK_LINK_JOBS}" << endl;
+  file << "  magick_heavy_link=${MAGICK_HEAVY_LINK_JOBS}" << endl;
+  file << ")" << endl;
+}
+
+void Solution::writeLanguages(const ConfigureWizard &wizard,wofstream &file,const bool exported,const wstring &directory)
+{
+  bool
+    hasTests,
+    useNasm;
+
+  hasTests=false;
+  useNasm=false;
+  for (const auto& p : _projects)
+  {
+    for (const auto& pf : p->files())
+    {
+      if (!isWritten(wizard,pf) || pf->isExported() != exported)
+        continue;
+
+      if (pf->useNasm())
+        useNasm=true;
+      if (!p->tests().empty())
+        hasTests=true;
+    }
+  }
+
+  /* The bundled nasm is preferred over the one in the path */
+  if (useNasm)
+  {
+    file << "if(NOT CMAKE_ASM_NASM_COMPILER)" << endl;
+    file << "  find_program(CMAKE_ASM_NASM_COMPILER NAMES nasm HINTS \"${CMAKE_CURRENT_SOURCE_DIR}" << directory << "/VisualStudioProjects/build\")" << endl;
+    file << "endif()" << endl;
+    file << "if(NOT CMAKE_ASM_NASM_COMPILER)" << endl;
+    file << "  message(FATAL_ERROR \"Unable to find nasm that is required to assemble the SIMD kernels\")" << endl;
+    file << "endif()" << endl;
+    file << "enable_language(ASM_NASM)" << endl;
+  }
+
+  if (hasTests)
+    file << "enable_testing()" << endl;
+}
+
+bool Solution::isWritten(const ConfigureWizard &wizard,const ProjectFile *projectFile)
+{
+  if (projectFile->prefix().compare(L"CORE") == 0)
+    return(true);
+
+  /* The format list and the AVX2 modules need a target for each coder and filter */
+  if ((wizard.solutionType() != SolutionType::DYNAMIC_MT) || (wizard.formats().empty() && !wizard.avx2Modules()))
+    return(false);
+
+  return((projectFile->prefix().compare(L"IM_MOD") == 0) || (projectFile->prefix().compare(L"FILTER") == 0));
+}
+
+void Solution::writeModuleShards(const ConfigureWizard &wizard)
+{
+  vector<pair<wstring,wstring>>
+    coders,
+    filters;
+
+  vector<wstring>
+    coderShards,
+    filterShards;
+
+  wofstream
+    outputStream;
+
+  wstring
+    name;
+
+  if ((wizard.solutionType() != SolutionType::DYNAMIC_MT) || (wizard.moduleShards() == 0))
+    return;
+
+  foreach (Project*,p,_projects)
+  {
+    foreach (ProjectFile*,pf,(*p)->files())
+    {
+      /* The variants of a shard contain the same modules */
+      if (!(*pf)->variant().empty() && (*pf)->variant() != wizard.variants()[0])
+        continue;
+
+      /* The AVX2 modules have the same names as the baseline modules */
+      if (!(*pf)->isa().empty())
+        continue;
+
+      foreach (wstring,module,(*pf)->modules())
+      {
+        if ((*p)->modulePrefix() == L"IM_MOD")
+        {
+          name=*module;
+          transform(name.begin(),name.end(),name.begin(),::towupper);
+          coders.push_back(make_pair(name,(*pf)->moduleName()));
+        }
+        else if ((*p)->modulePrefix() == L"FILTER")
+          filters.push_back(make_pair(*module,(*pf)->moduleName()));
+      }
+
+      /* A project gets fewer shards than requested when it has fewer groups of modules */
+      if ((*p)->modulePrefix() == L"IM_MOD" && !contains(coderShards,(*pf)->moduleName()))
+        coderShards.push_back((*pf)->moduleName());
+      else if ((*p)->modulePrefix() == L"FILTER" && !contains(filterShards,(*pf)->moduleName()))
+        filterShards.push_back((*pf)->moduleName());
+    }
+  }
+
+  outputStream.open(L"..\\..\\ImageMagick\\" + getFolder() + L"\\module-shards.h");
+  if (!outputStream)
+    return;
+
+  sort(coders.begin(),coders.end());
+  sort(filters.begin(),filters.end());
+
+  outputStream << "/*" << endl;
+  outputStream << "  The shard (e.g. shard1 for IM_MOD_RL_shard1_.dll) that contains each coder" << endl;
+  outputStream << "  and filter, sorted by name. Define AddMagickCoderShard and/or" << endl;
+  outputStream << "  AddMagickFilterShard before including this file to expand the lists." << endl;
+  outputStream << "*/" << endl;
+  outputStream << "#ifndef MAGICKCORE_CODER_SHARD_COUNT" << endl;
+  outputStream << "#define MAGICKCORE_CODER_SHARD_COUNT " << coderShards.size() << endl;
+  outputStream << "#define MAGICKCORE_FILTER_SHARD_COUNT " << filterShards.size() << endl;
+  outputStream << "#endif" << endl;
+  outputStream << endl;
+  outputStream << "#if defined(AddMagickCoderShard)" << endl;
+  for (const auto& coder : coders)
+  {
+    outputStream << "AddMagickCoderShard(\"" << coder.first << "\",\"" << coder.second << "\")" << endl;
+  }
+  outputStream << "#endif" << endl;
+  outputStream << endl;
+  outputStream << "#if defined(AddMagickFilterShard)" << endl;
+  for (const auto& filter : filters)
+  {
+    outputStream << "AddMagickFilterShard(\"" << filter.first << "\",\"" << filter.second << "\")" << endl;
+  }
+  outputStream << "#endif" << endl;
+
+  outputStream.close();
+}
+
+void Solution::writeMagickBaseConfig(const ConfigureWizard &wizard)
+{
+  bool
+    useHDRI;
+
+  QuantumDepth
+    quantumDepth;
+
+  wstring
+    folder,
+    variantFolder;
+
+  folder=getFolder();
+
+  writeMagickBaseConfig(wizard,wizard.quantumDepth(),wizard.useHDRI(),L"..\\..\\ImageMagick\\" + folder + L"\\magick-baseconfig.h");
+
+  /* Each variant includes its own copy before the one in the ImageMagick folder */
+  foreach_const (wstring,variant,wizard.variants())
+  {
+    parseVariant(*variant,quantumDepth,useHDRI);
+
+    variantFolder=L"..\\variants";
+    CreateDirectoryW(variantFolder.c_str(),NULL);
+    variantFolder+=L"\\" + *variant;
+    CreateDirectoryW(variantFolder.c_str(),NULL);
+    variantFolder+=L"\\" + folder;
+    CreateDirectoryW(variantFolder.c_str(),NULL);
+
+    writeMagickBaseConfig(wizard,quantumDepth,useHDRI,variantFolder + L"\\magick-baseconfig.h");
+  }
+}
+
+void Solution::writeMagickBaseConfig(const ConfigureWizard &wizard,const QuantumDepth quantumDepth,const bool useHDRI,const wstring &fileName)
+{
+  wstring
+    folder,
+    line;
+
+  wifstream
+    configIn;
+
+  wofstream
+    config;
+
+  folder=getFolder();
+
+  configIn.open(L"..\\" + folder + L"\\magick-baseconfig.h.in");
+  if (!configIn)
+    return;
+
+  config.open(fileName);
+  if (!config)
+    return;
+
+  while (getline(configIn,line))
+  {
+    if (trim(line).compare(L"$$CONFIG$$") != 0)
+    {
+      config << line << endl;
+      continue;
+    }
+
+    config << "/*" << endl;
+    config << "  Define to build a ImageMagick which uses registry settings or" << endl;
+    config << "  hard-coded paths to locate installed components.  This supports" << endl;
+    config << "  using the \"setup.exe\" style installer, or using hard-coded path" << endl;
+    config << "  definitions (see below).  If you want to be able to simply copy" << endl;
+    config << "  the built ImageMagick to any directory on any directory on any machine," << endl;
+    config << "  then do not use this setting." << endl;
+    config << "*/" << endl;
+    if (wizard.installedSupport())
+      config << "#define MAGICKCORE_INSTALLED_SUPPORT" << endl;
+    else
+      config << "#undef MAGICKCORE_INSTALLED_SUPPORT" << endl;
+    config << endl;
+
+    config << "/*" << endl;
+    config << "  Specify size of PixelPacket color Quantums (8, 16, or 32)." << endl;
+    config << "  A value of 8 uses half the memory than 16 and typically runs 30% faster," << endl;
+    config << "  but provides 256 times less color resolution than a value of 16." << endl;
+    config << "*/" << endl;
+    if (quantumDepth == QuantumDepth::Q8)
+      config << "#define MAGICKCORE_QUANTUM_DEPTH 8" << endl;
+    else if (quantumDepth == QuantumDepth::Q16)
+      config << "#define MAGICKCORE_QUANTUM_DEPTH 16" << endl;
+    else if (quantumDepth == QuantumDepth::Q32)
+      config << "#define MAGICKCORE_QUANTUM_DEPTH 32" << endl;
+    else if (quantumDepth == QuantumDepth::Q64)
+      config << "#define MAGICKCORE_QUANTUM_DEPTH 64" << endl;
+    config << endl;
+
+    if (isImageMagick7(wizard))
+      {
+        config << "/*" << endl;
+        config << "  Channel mask depth" << endl;
+        config << "*/" << endl;
+        config << "#if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)" << endl;
+        config << "#ifdef _WIN64" << endl;
+        config << "#define MAGICKCORE_CHANNEL_MASK_DEPTH 64" << endl;
+        config << "#else" << endl;
+        config << "#define MAGICKCORE_CHANNEL_MASK_DEPTH 32" << endl;
+        config << "#endif" << endl;
+        config << "#else" << endl;
+        config << "#define MAGICKCORE_CHANNEL_MASK_DEPTH 32" << endl;
+        config << "#endif" << endl;
+        config << endl;
+      }
+
+    config << "/*" << endl;
+    config << "  Define to enable high dynamic range imagery (HDRI)" << endl;
+    config << "*/" << endl;
+    if (useHDRI)
+      config << "#define MAGICKCORE_HDRI_ENABLE 1" << endl;
+    else
+      config << "#define MAGICKCORE_HDRI_ENABLE 0" << endl;
+    config << endl;
+
+    config << "/*" << endl;
+    config << "  Define to enable OpenCL" << endl;
+    config << "*/" << endl;
+    if (wizard.useOpenCL())
+      config << "#define MAGICKCORE_HAVE_CL_CL_H" << endl;
+    else
+      config << "#undef MAGICKCORE_HAVE_CL_CL_H" << endl;
+    config << endl;
+
+    config << "/*" << endl;
+    config << "  Define to enable Distributed Pixel Cache" << endl;
+    config << "*/" << endl;
+    if (wizard.enableDpc())
+      config << "#define MAGICKCORE_DPC_SUPPORT" << endl;
+    else
+      config << "#undef MAGICKCORE_DPC_SUPPORT" << endl;
+    config << endl;
+
+    config << "/*" << endl;
+    config << "  Exclude deprecated methods in MagickCore API" << endl;
+    config << "*/" << endl;
+    if (wizard.excludeDeprecated())
+      config << "#define MAGICKCORE_EXCLUDE_DEPRECATED" << endl;
+    else
+      config << "#undef MAGICKCORE_EXCLUDE_DEPRECATED" << endl;
+    config << endl;
+
+    config << "/*" << endl;
+    config << "  Define to register only the coders and filters that are listed in" << endl;
+    config << "  static-modules.h instead of all the known static modules." << endl;
+    config << "*/" << endl;
+    /* The static registration of MagickCore does not read static-modules.h yet */
+    config << "#undef MAGICKCORE_STATIC_MODULES_LIST" << endl;
+    config << endl;
+
+    config << "/*" << endl;
+    config << "  Define to load the coders and filters from the shared libraries that" << endl;
+    config << "  are listed in module-shards.h instead of one library per module." << endl;
+    config << "*/" << endl;
+    config << "#undef MAGICKCORE_MODULE_SHARDS" << endl;
+    config << endl;
+
+    config << "/*" << endl;
+    config << "  Define to the directory, relative to the MagickCore library, of the coders" << endl;
+    config << "  and filters that are used when the processor supports AVX2." << endl;
+    config << "*/" << endl;
+    if ((wizard.solutionType() == SolutionType::DYNAMIC_MT) && wizard.avx2Modules())
+      config << "#define MAGICKCORE_MODULES_AVX2_DIRECTORY \"modules-avx2\"" << endl;
+    else
+      config << "#undef MAGICKCORE_MODULES_AVX2_DIRECTORY" << endl;
+    config << endl;
+
+    config << "/*" << endl;
+    config << "  Define to the instruction set level that the build requires." << endl;
+    config << "*/" << endl;
+    if (wizard.targetIsa() != TargetIsa::BASELINE)
+      config << "#define MAGICKCORE_TARGET_ISA \"" << wizard.targetIsaName() << "\"" << endl;
+    else
+      config << "#undef MAGICKCORE_TARGET_ISA" << endl;
+    switch (wizard.targetIsa())
+    {
+      case TargetIsa::X86_64_V4:
+        config << "#define MAGICKCORE_HAVE_AVX512 1" << endl;
+        [[fallthrough]];
+      case TargetIsa::X86_64_V3:
+        config << "#define MAGICKCORE_HAVE_AVX2 1" << endl;
+        config << "#define MAGICKCORE_HAVE_FMA 1" << endl;
+        config << "#define MAGICKCORE_HAVE_SSE4_2 1" << endl;
+        break;
+      case TargetIsa::X86_64_V2:
+        /* MSVC gets no switch for this level */
+        config << "#if !defined(_MSC_VER) || defined(__clang__)" << endl;
+        config << "#define MAGICKCORE_HAVE_SSE4_2 1" << endl;
+        config << "#endif" << endl;
+        break;
+      case TargetIsa::ARMV8_2:
+        config << "#define MAGICKCORE_HAVE_ARMV8_2 1" << endl;
+        break;
+      default:
+        break;
+    }
+    config << endl;
+
+    config << "/*" << endl;
+    config << "  Define to only use the built-in (in-memory) settings." << endl;
+    config << "*/" << endl;
+    if (wizard.zeroConfigurationSupport())
+      config << "#define MAGICKCORE_ZERO_CONFIGURATION_SUPPORT 1" << endl;
+    else
+      config << "#define MAGICKCORE_ZERO_CONFIGURATION_SUPPORT 0" << endl;
+
+    foreach (Project*,p,_projects)
+    {
+      if ((*p)->files().size() == 0)
+        continue;
+
+      if ((*p)->configDefine().empty())
+        continue;
+
+      config << endl;
+      config << (*p)->configDefine();
+    }
+  }
+}
+
+void Solution::writeMakeFile(const ConfigureWizard &wizard)
+{
+  wifstream
+    makeFileIn,
+    zipIn;
+
+  wofstream
+    lib,
+    makeFile,
+    zip;
+
+  wstring
+    libName,
+    line;
+
+  libName=L"CORE_RL_" + getFolder()+ L"_";
+
+  lib=wofstream(L"..\\..\\ImageMagick\\PerlMagick\\" + libName + L".a");
+  if (!lib)
+    return;
+  lib.close();
+
+  zipIn=wifstream(L"..\\PerlMagick\\Zip.ps1", std::ios::binary);
+  if (!zipIn)
+    return;
+  zip=wofstream(L"..\\..\\ImageMagick\\PerlMagick\\Zip.ps1", std::ios::binary);
+  zip << zipIn.rdbuf();
+  zip.close();
+
+  makeFileIn.open(L"..\\PerlMagick\\Makefile.PL.in");
+  if (!makeFileIn)
+    return;
+
+  makeFile.open(L"..\\..\\ImageMagick\\PerlMagick\\Makefile.PL");
+  if (!makeFile)
+    return;
+
+  while (getline(makeFileIn,line))
+  {
+    line=replace(line,L"$$LIB_NAME$$",libName);
+    line=replace(line,L"$$PLATFORM$$",wizard.platformAlias());
+    makeFile << line << endl;
+  }
+  makeFile.close();
+}
+
+void Solution::writeNotice(const ConfigureWizard &wizard,const VersionInfo &versionInfo)
+{
+  wofstream
+    notice;
+
+  notice.open(L"..\\..\\VisualMagick\\NOTICE.txt");
+  if (!notice)
+    return;
+
+  notice << "* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *" << endl << endl;
+  notice << "[ Imagemagick " << versionInfo.version() << versionInfo.libAddendum() << "] copyright:" << endl << endl;
+  notice << readLicense(L"..\\..\\ImageMagick\\LICENSE");
+  notice << endl << "* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *" << endl << endl;
+
+  foreach (Project*,p,_projects)
+  {
+    if (((*p)->notice() == L"") || (*p)->shouldSkip(wizard))
+      continue;
+
+    notice << (*p)->notice();
+    notice << "* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *" << endl << endl;
+  }
+
+  notice.close();
+}
+
+void Solution::writePolicyConfig(const ConfigureWizard &wizard)
+{
+  wchar_t
+    buffer[512];
+
+  wifstream
+    infile;
+
+  wofstream
+    outfile;
+
+  switch(wizard.policyConfig())
+  {
+  case PolicyConfig::LIMITED:
+    infile=wifstream(L"..\\..\\ImageMagick\\config\\policy-limited.xml");
+    break;
+  case PolicyConfig::OPEN:
+    infile=wifstream(L"..\\..\\ImageMagick\\config\\policy-open.xml");
+    break;
+  case PolicyConfig::SECURE:
+    infile=wifstream(L"..\\..\\ImageMagick\\config\\policy-secure.xml");
+    break;
+  case PolicyConfig::WEBSAFE:
+    infile=wifstream(L"..\\..\\ImageMagick\\config\\policy-websafe.xml");
+    break;
+  }
+  if (!infile)
+    throwException(L"Unable to open policy file");
+  outfile=wofstream(L"..\\bin\\policy.xml");
+  while (infile.read(buffer, 512))
+    outfile.write(buffer, infile.gcount());
+  outfile.write(buffer, infile.gcount());
+  infile.close();
+  outfile.close();
+}
+
+void Solution::writeStaticModules(const ConfigureWizard &wizard)
+{
+  map<wstring,wstring>
+    formats;
+
+  vector<wstring>
+    coders,
+    filters;
+
+  wofstream
+    outputStream;
+
+  if (wizard.solutionType() == SolutionType::DYNAMIC_MT)
+    return;
+
+  foreach (Project*,p,_projects)
+  {
+    if ((*p)->files().size() == 0)
+      continue;
+
+    if ((*p)->modulePrefix() == L"IM_MOD")
+    {
+      coders.insert(coders.end(),(*p)->modules().begin(),(*p)->modules().end());
+      for (const auto& f : (*p)->formatModules())
+        formats.insert(make_pair(f.first,toUpper(f.second)));
+    }
+    else if ((*p)->modulePrefix() == L"FILTER")
+      filters.insert(filters.end(),(*p)->modules().begin(),(*p)->modules().end());
+  }
+
+  outputStream.open(L"..\\..\\ImageMagick\\" + getFolder() + L"\\static-modules.h");
+  if (!outputStream)
+    return;
+
+  /* The coders are registered with their upper case name, e.g. RegisterJPEGImage */
+  foreach (wstring,coder,coders)
+  {
+    *coder=toUpper(*coder);
+  }
+  sort(coders.begin(),coders.end());
+  sort(filters.begin(),filters.end());
+
+  outputStream << "/*" << endl;
+  outputStream << "  The coders and filters that are included in this static build, sorted by" << endl;
+  outputStream << "  name. Define AddMagickCoder and/or AddMagickFilter before including this" << endl;
+  outputStream << "  file to expand the lists." << endl;
+  outputStream << endl;
+  outputStream << "  AddMagickCoderFormat(\"FORMAT\",CODER) maps every format name and alias" << endl;
+  outputStream << "  to the coder that registers it. The entries are sorted by the upper case" << endl;
+  outputStream << "  format name so a table that is built from them can be searched with" << endl;
+  outputStream << "  bsearch and strcmp on the upper case name." << endl;
+  outputStream << "*/" << endl;
+  outputStream << "#ifndef MAGICKCORE_STATIC_CODER_COUNT" << endl;
+  outputStream << "#define MAGICKCORE_STATIC_CODER_COUNT " << coders.size() << endl;
+  outputStream << "#define MAGICKCORE_STATIC_FILTER_COUNT " << filters.size() << endl;
+  outputStream << "#define MAGICKCORE_STATIC_FORMAT_COUNT " << formats.size() << endl;
+  outputStream << "#endif" << endl;
+  outputStream << endl;
+  outputStream << "#if defined(AddMagickCoderFormat)" << endl;
+  for (const auto& f : formats)
+  {
+    outputStream << "AddMagickCoderFormat(\"" << f.first << "\"," << f.second << ")" << endl;
+  }
+  outputStream << "#endif" << endl;
+  outputStream << endl;
+  outputStream << "#if defined(AddMagickCoder)" << endl;
+  foreach (wstring,coder,coders)
+  {
+    outputStream << "AddMagickCoder(" << *coder << ")" << endl;
+  }
+  outputStream << "#endif" << endl;
+  outputStream << endl;
+  outputStream << "#if defined(AddMagickFilter)" << endl;
+  foreach (wstring,filter,filters)
+  {
+    outputStream << "AddMagickFilter(" << *filter << ")" << endl;
+  }
+  outputStream << "#endif" << endl;
+
+  outputStream.close();
+}
+
+void Solution::writeThresholdMap(const ConfigureWizard &wizard)
+{
+  wifstream
+    inputStream;
+
+  wofstream
+    outputStream;
+
+  wstring
+    line;
+
+  if (!wizard.zeroConfigurationSupport())
+    return;
+
+  inputStream.open(L"..\\bin\\thresholds.xml");
+  if (!inputStream)
+    return;
+
+  outputStream.open(L"..\\..\\ImageMagick\\MagickCore\\threshold-map.h");
+  if (!outputStream)
+    {
+      inputStream.close();
+      return;
+    }
+
+  outputStream << "static const char *const BuiltinMap=" << endl;
+
+  while (getline(inputStream,line))
+  {
+    if (line.length() == 0)
+      continue;
+
+    line=replace(line,L"\"",L"\\\"");
+    outputStream << "\"" << line << "\"" << endl;
+  }
+
+  outputStream << ";";
+
+  inputStream.close();
+  outputStream.close();
+}
+
+void Solution::writeVersion(const ConfigureWizard &wizard,const VersionInfo &versionInfo)
+{
+
+  wstring
+    folder,
+    line;
+
+  folder=getFolder();
+
+  writeVersion(wizard,versionInfo,L"..\\..\\ImageMagick\\"+folder+L"\\version.h.in",L"..\\..\\ImageMagick\\"+folder+L"\\version.h");
+  writeVersion(wizard,versionInfo,L"..\\..\\ImageMagick\\config\\configure.xml.in",L"..\\bin\\configure.xml");
+  writeVersion(wizard,versionInfo,L"..\\installer\\inc\\version.isx.in",L"..\\installer\\inc\\version.isx");
+  writeVersion(wizard,versionInfo,L"..\\utilities\\ImageMagick.version.h.in",L"..\\utilities\\ImageMagick.version.h");
+}
+
+void Solution::writeVersion(const ConfigureWizard &wizard,const VersionInfo &versionInfo,wstring input,wstring output)
+{
+  size_t
+    start,
+    end;
+
+  wifstream
+    inputStream;
+
+  wofstream
+    outputStream;
+
+  wstring
+    line;
+
+  inputStream.open(input);
+  if (!inputStream)
+    return;
+
+  outputStream.open(output);
+  if (!outputStream)
+    {
+      inputStream.close();
+      return;
+    }
+
+  while (getline(inputStream,line))
+  {
+    line=replace(line,L"@CC@",wizard.visualStudioVersionName());
+    line=replace(line,L"@CHANNEL_MASK_DEPTH@",wizard.channelMaskDepth());
+    line=replace(line,L"@CXX@",wizard.visualStudioVersionName());
+    line=replace(line,L"@DOCUMENTATION_PATH@",L"unavailable");
+    line=replace(line,L"@LIB_VERSION@",versionInfo.version());
+    line=replace(line,L"@MAGICK_GIT_REVISION@",versionInfo.gitRevision());
+    line=replace(line,L"@MAGICK_ISA_SUFFIX@",wizard.targetIsa() != TargetIsa::BASELINE ? L"-" + wizard.targetIsaName() : L"");
+    line=replace(line,L"@MAGICK_LIB_VERSION_NUMBER@",versionInfo.libVersionNumber());
+    line=replace(line,L"@MAGICK_LIB_VERSION_TEXT@",versionInfo.version());
+    line=replace(line,L"@MAGICK_LIBRARY_CURRENT@",versionInfo.interfaceVersion());
+    line=replace(line,L"@MAGICK_LIBRARY_CURRENT_MIN@",versionInfo.interfaceVersion());
+    line=replace(line,L"@MAGICK_TARGET_CPU@",wizard.platformAlias());
+    line=replace(line,L"@MAGICK_TARGET_OS@",wizard.targetOS());
+    line=replace(line,L"@MAGICKPP_LIB_VERSION_TEXT@",versionInfo.version());
+    line=replace(line,L"@MAGICKPP_LIBRARY_CURRENT@",versionInfo.ppInterfaceVersion());
+    line=replace(line,L"@MAGICKPP_LIBRARY_CURRENT_MIN@",versionInfo.ppInterfaceVersion());
+    line=replace(line,L"@MAGICKPP_LIBRARY_VERSION_INFO@",versionInfo.ppLibVersionNumber());
+    line=replace(line,L"@MAGICKPP_LIBRARY_VERSION_TEXT@",versionInfo.version());
+    line=replace(line,L"@PACKAGE_BASE_VERSION@",versionInfo.version());
+    line=replace(line,L"@PACKAGE_FULL_VERSION@",versionInfo.fullVersion());
+    line=replace(line,L"@PACKAGE_LIB_VERSION@",versionInfo.libVersion());
+    line=replace(line,L"@PACKAGE_LIB_VERSION_NUMBER@",versionInfo.versionNumber());
+    line=replace(line,L"@PACKAGE_NAME@",L"ImageMagick");
+    line=replace(line,L"@PACKAGE_VERSION_ADDENDUM@",versionInfo.libAddendum());
+    line=replace(line,L"@PACKAGE_RELEASE_DATE@",versionInfo.releaseDate());
+    line=replace(line,L"@QUANTUM_DEPTH@",to_wstring((int) wizard.quantumDepth()));
+    line=replace(line,L"@RELEASE_DATE@",versionInfo.releaseDate());
+    line=replace(line,L"@TARGET_OS@",wizard.targetOS());
+    start=line.find(L"@");
+    if (start != string::npos)
+    {
+      end=line.find(L"@",start+1);
+      if (end != string::npos)
+        checkKeyword(line.substr(start+1,end-start-1));
+      continue;
+    }
+    /* The configure.xml.in of ImageMagick has no placeholder for the ISA level */
+    if ((line.find(L"</configuremap>") != string::npos) && (wizard.targetIsa() != TargetIsa::BASELINE))
+      outputStream << "  <configure name=\"TARGET_ISA\" value=\"" << wizard.targetIsaName() << "\"/>" << endl;
+    outputStream << line << endl;
+  }
+
+  inputStream.close();
+  outputStream.close();
+}
+
+void Solution::assignJobPools(const ConfigureWizard &wizard)
+{
+  map<ProjectFile*,size_t>
+    weights;
+
+  size_t
+    libraryObjects,
+    maxWeight,
+    memory,
+    weight;
+
+  /* The weight of a target is the number of objects that are passed to the linker */
+  libraryObjects=0;
+  foreach (Project*,p,_projects)
+  {
+    foreach (ProjectFile*,pf,(*p)->files())
+    {
+      if (isWritten(wizard,*pf) && (*pf)->isLib())
+        libraryObjects+=(*pf)->objectCount();
+    }
+  }
+
+  maxWeight=0;
+  foreach (Project*,p,_projects)
+  {
+    foreach (ProjectFile*,pf,(*p)->files())
+    {
+      if (!isWritten(wizard,*pf))
+        continue;
+
+      /* The programs and libraries of a static build link all the static libraries */
+      weight=(*pf)->objectCount();
+      if (!(*pf)->isLib() && wizard.solutionType() != SolutionType::DYNAMIC_MT)
+        weight+=libraryObjects;
+      weights[*pf]=weight;
+      maxWeight=max(maxWeight,weight);
+    }
+  }
+
+  for (const auto& w : weights)
+  {
+    memory=linkBaseMemory+w.second*linkObjectMemory;
+    if (w.second*heavyLinkRatio >= maxWeight)
+    {
+      w.first->jobPoolLink(L"magick_heavy_link");
+      _heavyLinkMemory=max(_heavyLinkMemory,memory);
+    }
+    else
+    {
+      w.first->jobPoolLink(L"magick_link");
+      _linkMemory=max(_linkMemory,memory);
+    }
+  }
+}
+
+void Solution::assignObjectLibraries(const ConfigureWizard &wizard)
+{
+  vector<ProjectFile*>
+    absorbed,
+    objectLibraries;
+
+  /* The static libraries absorb the objects first so every program that links them gets the objects */
+  for (int pass=0; pass < 2; pass++)
+  {
+    foreach (Project*,p,_projects)
+    {
+      foreach (ProjectFile*,pf,(*p)->files())
+      {
+        if (!isWritten(wizard,*pf) || (*pf)->isObjectLibrary() || (*pf)->isLib() != (pass == 0))
+          continue;
+
+        objectLibraries.clear();
+        collectObjectLibraries(*pf,objectLibraries);
+        foreach (ProjectFile*,objectLibrary,objectLibraries)
+        {
+          if (find(absorbed.begin(),absorbed.end(),*objectLibrary) != absorbed.end())
+            continue;
+
+          (*pf)->absorb(*objectLibrary);
+          absorbed.push_back(*objectLibrary);
+        }
+      }
+    }
+  }
+}
+
+void Solution::checkKeyword(const wstring keyword)
+{
+  vector<wstring> skipableKeywords={
+    L"CODER_PATH",L"CONFIGURE_ARGS",L"CONFIGURE_PATH",L"CXXFLAGS",L"DEFS",L"DISTCHECK_CONFIG_FLAGS",
+    L"EXEC_PREFIX_DIR",L"EXECUTABLE_PATH",L"FILTER_PATH",L"host",L"INCLUDE_PATH",L"LIBRARY_PATH",
+    L"MAGICK_CFLAGS",L"MAGICK_CPPFLAGS",L"MAGICK_DELEGATES",L"MAGICK_FEATURES",L"MAGICK_LDFLAGS",
+    L"MAGICK_LIBS",L"MAGICK_PCFLAGS",L"MAGICK_SECURITY_POLICY",L"MAGICK_TARGET_VENDOR",L"PREFIX_DIR",
+    L"SHARE_PATH",L"SHAREARCH_PATH"
+  };
+
+  if (contains(skipableKeywords,keyword))
+    return;
+
+  throwException(L"Invalid keyword: " + keyword);
+}
+
+void Solution::write(const ConfigureWizard &wizard,wofstream &file)
+{
+  writeHeader(wizard,file,L"Visual" + wizard.solutionName());
+
+  file << "set(CMAKE_LIBRARY_OUTPUT_DIRECTORY \"" << wizard.libDirectory() << "\")" << endl;
+  file << "set(CMAKE_RUNTIME_OUTPUT_DIRECTORY \"" << wizard.binDirectory() << "\")" << endl;
+  file << "set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY \"" << wizard.libDirectory() << "\")" << endl;
+
+  file << "link_directories(\"" << wizard.libDirectory() << "\")" << endl;
+
+  writeRuntimeLibrary(wizard,file);
+
+  writeInterfaceLibraries(wizard,file);
+
+  writeJobPools(wizard,file);
+
+  writeLanguages(wizard,file,false,L"");
+
+  if (wizard.delegateSdk())
+    writeDelegatesPackage(wizard,file);
+
+  for (const auto& p : _projects)
+  {
+    for (const auto& pf : p->files())
+    {
+      if (!isWritten(wizard,pf) || pf->isExported())
+        continue;
+
+      if (wizard.flatCMake())
+        file << "include(VisualStudioProjects/" << pf->name() << "/" << pf->fileName() << ")" << endl;
+      else
+        file << "add_subdirectory(VisualStudioProjects/" << pf->name() << ")" << endl;
+    }
+  }
+}
+
+void Solution::writeDelegates(const ConfigureWizard &wizard)
+{
+  wofstream
+    file;
+
+  wstring
+    directory;
+
+  if (!wizard.delegateSdk())
+    return;
+
+  directory=L"..\\delegates";
+  CreateDirectoryW(directory.c_str(),NULL);
+
+  file.open(directory + L"\\CMakeLists.txt");
+  if (!file)
+    return;
+
+  writeHeader(wizard,file,L"Visual" + wizard.solutionName() + L"Delegates");
+
+  /* The debug and release libraries are installed in the same directory */
+  file << "set(CMAKE_DEBUG_POSTFIX d)" << endl;
+
+  writeRuntimeLibrary(wizard,file);
+
+  writeInterfaceLibraries(wizard,file);
+
+  writeJobPools(wizard,file);
+
+  writeLanguages(wizard,file,true,L"/..");
+
+  file << "install(TARGETS magick_common magick_lib magick_dll EXPORT MagickDelegates)" << endl;
+
+  for (const auto& p : _projects)
+  {
+    for (const auto& pf : p->files())
+    {
+      if (isWritten(wizard,pf) && pf->isExported())
+        file << "add_subdirectory(../VisualStudioProjects/" << pf->name() << " " << pf->name() << ")" << endl;
+    }
+  }
+
+  file << "install(EXPORT MagickDelegates" << endl;
+  file << "  NAMESPACE MagickDelegates::" << endl;
+  file << "  FILE MagickDelegatesConfig.cmake" << endl;
+  file << "  DESTINATION lib/cmake/MagickDelegates" << endl;
+  file << ")" << endl;
+
+  file.close();
+}
+
+void Solution::writeDelegatesPackage(const ConfigureWizard &wizard,wofstream &file)
+{
+  vector<wstring>
+    directories;
+
+  /* The generator fingerprints the sources and the compiler fingerprint is added at configure time */
+  file << "set(MAGICK_DELEGATES_FINGERPRINT \"" << delegatesFingerprint(wizard) << "\")" << endl;
+  file << "string(SHA256 MAGICK_DELEGATES_KEY \"${MAGICK_DELEGATES_FINGERPRINT};${MAGICK_TOOLCHAIN};${CMAKE_GENERATOR};${CMAKE_GENERATOR_PLATFORM};${CMAKE_GENERATOR_TOOLSET};"
+    "${CMAKE_C_COMPILER_ID};${CMAKE_C_COMPILER_VERSION};${CMAKE_CXX_COMPILER_ID};${CMAKE_CXX_COMPILER_VERSION};"
+    "${CMAKE_C_FLAGS};${CMAKE_CXX_FLAGS};${CMAKE_BUILD_TYPE}\")" << endl;
+  file << "string(SUBSTRING \"${MAGICK_DELEGATES_KEY}\" 0 16 MAGICK_DELEGATES_KEY)" << endl;
+
+  file << "if(NOT MAGICK_DELEGATES_CACHE)" << endl;
+  file << "  if(DEFINED ENV{LOCALAPPDATA})" << endl;
+  file << "    file(TO_CMAKE_PATH \"$ENV{LOCALAPPDATA}/ImageMagick/delegates\" MAGICK_DELEGATES_CACHE)" << endl;
+  file << "  else()" << endl;
+  file << "    set(MAGICK_DELEGATES_CACHE \"$ENV{HOME}/.cache/ImageMagick/delegates\")" << endl;
+  file << "  endif()" << endl;
+  file << "endif()" << endl;
+  file << "set(MAGICK_DELEGATES_CACHE \"${MAGICK_DELEGATES_CACHE}\" CACHE PATH \"Directory of the installed delegate packages\")" << endl;
+  file << "set(MAGICK_DELEGATES_DIR \"${MAGICK_DELEGATES_CACHE}/${MAGICK_DELEGATES_KEY}\")" << endl;
+
+  /* The delegates are installed in a temporary directory and renamed so an interrupted build is never used */
+  file << "if(NOT EXISTS \"${MAGICK_DELEGATES_DIR}/lib/cmake/MagickDelegates/MagickDelegatesConfig.cmake\")" << endl;
+  file << "  message(STATUS \"Building the delegates in ${MAGICK_DELEGATES_DIR}\")" << endl;
+  file << "  get_property(MAGICK_MULTI_CONFIG GLOBAL PROPERTY GENERATOR_IS_MULTI_CONFIG)" << endl;
+  file << "  if(MAGICK_MULTI_CONFIG)" << endl;
+  file << "    set(MAGICK_DELEGATES_CONFIGS Debug Release)" << endl;
+  file << "  else()" << endl;
+  file << "    set(MAGICK_DELEGATES_CONFIGS ${CMAKE_BUILD_TYPE})" << endl;
+  file << "  endif()" << endl;
+  file << "  set(MAGICK_DELEGATES_ARGS -G \"${CMAKE_GENERATOR}\")" << endl;
+  file << "  if(CMAKE_GENERATOR_PLATFORM)" << endl;
+  file << "    list(APPEND MAGICK_DELEGATES_ARGS -A \"${CMAKE_GENERATOR_PLATFORM}\")" << endl;
+  file << "  endif()" << endl;
+  file << "  if(CMAKE_GENERATOR_TOOLSET)" << endl;
+  file << "    list(APPEND MAGICK_DELEGATES_ARGS -T \"${CMAKE_GENERATOR_TOOLSET}\")" << endl;
+  file << "  endif()" << endl;
+  file << "  if(CMAKE_C_COMPILER_LAUNCHER)" << endl;
+  file << "    list(APPEND MAGICK_DELEGATES_ARGS \"-DCMAKE_C_COMPILER_LAUNCHER=${CMAKE_C_COMPILER_LAUNCHER}\" \"-DCMAKE_CXX_COMPILER_LAUNCHER=${CMAKE_CXX_COMPILER_LAUNCHER}\")" << endl;
+  file << "  endif()" << endl;
+  file << "  file(REMOVE_RECURSE \"${MAGICK_DELEGATES_DIR}.tmp\")" << endl;
+  file << "  execute_process(" << endl;
+  file << "    COMMAND \"${CMAKE_COMMAND}\" -S \"${CMAKE_CURRENT_SOURCE_DIR}/delegates\" -B \"${CMAKE_CURRENT_BINARY_DIR}/delegates\" ${MAGICK_DELEGATES_ARGS}" << endl;
+  file << "      \"-DCMAKE_C_COMPILER=${CMAKE_C_COMPILER}\" \"-DCMAKE_CXX_COMPILER=${CMAKE_CXX_COMPILER}\"" << endl;
+  file << "      \"-DCMAKE_C_FLAGS=${CMAKE_C_FLAGS}\" \"-DCMAKE_CXX_FLAGS=${CMAKE_CXX_FLAGS}\"" << endl;
+  file << "      \"-DCMAKE_BUILD_TYPE=${CMAKE_BUILD_TYPE}\" \"-DMAGICK_TOOLCHAIN=${MAGICK_TOOLCHAIN}\"" << endl;
+  file << "      \"-DCMAKE_INSTALL_PREFIX=${MAGICK_DELEGATES_DIR}.tmp\"" << endl;
+  file << "    RESULT_VARIABLE MAGICK_DELEGATES_RESULT)" << endl;
+  file << "  if(NOT MAGICK_DELEGATES_RESULT EQUAL 0)" << endl;
+  file << "    message(FATAL_ERROR \"Unable to configure the delegates\")" << endl;
+  file << "  endif()" << endl;
+  file << "  foreach(MAGICK_DELEGATES_CONFIG ${MAGICK_DELEGATES_CONFIGS})" << endl;
+  file << "    execute_process(" << endl;
+  file << "      COMMAND \"${CMAKE_COMMAND}\" --build \"${CMAKE_CURRENT_BINARY_DIR}/delegates\" --config ${MAGICK_DELEGATES_CONFIG} --target install --parallel" << endl;
+  file << "      RESULT_VARIABLE MAGICK_DELEGATES_RESULT)" << endl;
+  file << "    if(NOT MAGICK_DELEGATES_RESULT EQUAL 0)" << endl;
+  file << "      message(FATAL_ERROR \"Unable to build the ${MAGICK_DELEGATES_CONFIG} delegates\")" << endl;
+  file << "    endif()" << endl;
+  file << "  endforeach()" << endl;
+  file << "  file(RENAME \"${MAGICK_DELEGATES_DIR}.tmp\" \"${MAGICK_DELEGATES_DIR}\")" << endl;
+  file << "endif()" << endl;
+
+  file << "find_package(MagickDelegates REQUIRED CONFIG PATHS \"${MAGICK_DELEGATES_DIR}\" NO_DEFAULT_PATH)" << endl;
+
+  if (wizard.solutionType() != SolutionType::DYNAMIC_MT)
+    return;
+
+  /* The programs load the delegate DLLs and the generated files from their own directory */
+  directories.push_back(wizard.binDirectory());
+  foreach_const(wstring,v,wizard.variants())
+  {
+    directories.push_back(wizard.binDirectory() + *v);
+  }
+  file << "file(GLOB MAGICK_DELEGATES_DLLS \"${MAGICK_DELEGATES_DIR}/bin/*.dll\" \"${MAGICK_DELEGATES_DIR}/bin/*.wisdom\")" << endl;
+  file << "if(MAGICK_DELEGATES_DLLS)" << endl;
+  file << "  add_custom_target(MagickDelegatesDlls ALL" << endl;
+  foreach (wstring,directory,directories)
+  {
+    file << "    COMMAND \"${CMAKE_COMMAND}\" -E make_directory \"" << *directory << "$<$<BOOL:${CMAKE_CONFIGURATION_TYPES}>:/$<CONFIG>>\"" << endl;
+    file << "    COMMAND \"${CMAKE_COMMAND}\" -E copy_if_different ${MAGICK_DELEGATES_DLLS} \"" << *directory << "$<$<BOOL:${CMAKE_CONFIGURATION_TYPES}>:/$<CONFIG>>\"" << endl;
+  }
+  file << "  )" << endl;
+  file << "endif()" << endl;
+}
+
+void Solution::writeHeader(const ConfigureWizard &wizard,wofstream &file,const wstring &projectName)
+{
+  wstring
+    launcher;
+
+  file << "cmake_minimum_required(VERSION " << wizard.cmakeMinVersion() << ")" << endl;
+  file << "project(" << projectName << " LANGUAGES C CXX ASM" << ")" << endl;
+
+  file << "set(CMAKE_CXX_STANDARD 17)" << endl;
+  file << "set(CMAKE_CXX_STANDARD_REQUIRED ON)" << endl;
+
+  file << "set(CMAKE_C_STANDARD 17)" << endl;
+  file << "set(CMAKE_C_STANDARD_REQUIRED ON)" << endl;
+
+  file << "if(NOT MAGICK_TOOLCHAIN)" << endl;
+  file << "  if(MSVC AND CMAKE_C_COMPILER_ID STREQUAL \"Clang\")" << endl;
+  file << "    set(MAGICK_TOOLCHAIN " << toolchainName(Toolchain::ClangCL) << ")" << endl;
+  file << "  elseif(MSVC)" << endl;
+  file << "    set(MAGICK_TOOLCHAIN " << toolchainName(Toolchain::MSVC) << ")" << endl;
+  file << "  else()" << endl;
+  file << "    set(MAGICK_TOOLCHAIN " << toolchainName(Toolchain::GNU) << ")" << endl;
+  file << "  endif()" << endl;
+  file << "endif()" << endl;
+
+  if (wizard.cacheableDebugInfo())
+  {
+    /* Embedded (/Z7) debug information avoids the shared pdb that serializes compilation and cannot be cached */
+    file << "set(CMAKE_MSVC_DEBUG_INFORMATION_FORMAT Embedded)" << endl;
+  }
+
+  if (!wizard.compilerLauncher().empty())
+  {
+    /* A backslash in a quoted CMake string starts an escape sequence */
+    launcher=replace(wizard.compilerLauncher(),L"\\",L"/");
+    file << "if(NOT DEFINED CMAKE_C_COMPILER_LAUNCHER)" << endl;
+    file << "  set(CMAKE_C_COMPILER_LAUNCHER \"" << launcher << "\")" << endl;
+    file << "endif()" << endl;
+    file << "if(NOT DEFINED CMAKE_CXX_COMPILER_LAUNCHER)" << endl;
+    file << "  set(CMAKE_CXX_COMPILER_LAUNCHER \"" << launcher << "\")" << endl;
+    file << "endif()" << endl;
+  }
+}
+
+void Solution::writeRuntimeLibrary(const ConfigureWizard &wizard,wofstream &file)
+{
+  if (wizard.targetLinux())
+  {
+    file << "set(CMAKE_POSITION_INDEPENDENT_CODE ON)" << endl;
+    return;
+  }
+
+  switch (wizard.solutionType())
+  {
+  case SolutionType::STATIC_MTD:
+  case SolutionType::DYNAMIC_MT:
+    file << "set(CMAKE_MSVC_RUNTIME_LIBRARY \"MultiThreaded$<$<CONFIG:Debug>:Debug>DLL\")" << endl;
+    break;
+  case SolutionType::STATIC_MT:
+    file << "set(CMAKE_MSVC_RUNTIME_LIBRARY \"MultiThreaded$<$<CONFIG:Debug>:Debug>\")" << endl;
+    break;
+  default:
+    break;
+  }
+}
@@ -1,68 +1,109 @@
-/*
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-%                                                                             %
-%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
-%  dedicated to making software imaging solutions freely available.           %
-%                                                                             %
-%  You may not use this file except in compliance with the License.  You may  %
-%  obtain a copy of the License at                                            %
-%                                                                             %
-%    http://www.imagemagick.org/script/license.php                            %
-%                                                                             %
-%  Unless required by applicable law or agreed to in writing, software        %
-%  distributed under the License is distributed on an "AS IS" BASIS,          %
-%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
-%  See the License for the specific language governing permissions and        %
-%  limitations under the License.                                             %
-%                                                                             %
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-*/
-#ifndef __Solution__
-#define __Solution__
-
-#include "Project.h"
-#include "ConfigureWizard.h"
-#include "VersionInfo.h"
-#include "WaitDialog.h"
-
-class Solution
-{
-public:
-  Solution();
-
-  int loadProjectFiles(const ConfigureWizard &wizard);
-
-  void loadProjects();
-
-  void write(const ConfigureWizard &wizard,WaitDialog &waitDialog);
-
-private:
-
-  void checkKeyword(const wstring keyword);
-
-  wstring getFileName(const ConfigureWizard &wizard);
-
-  wstring getFolder();
-
-  bool isImageMagick7(const ConfigureWizard &wizard);
-
-  void writeMagickBaseConfig(const ConfigureWizard &wizard);
-
-  void writeMakeFile(const ConfigureWizard &wizard);
-
-  void writeNotice(const ConfigureWizard &wizard,const VersionInfo &versionInfo);
-
-  void writePolicyConfig(const ConfigureWizard &wizard);
-
-  void writeThresholdMap(const ConfigureWizard &wizard);
-
-  void writeVersion(const ConfigureWizard &wizard,const VersionInfo &versionInfo);
-
-  void writeVersion(const ConfigureWizard &wizard,const VersionInfo &versionInfo,wstring input,wstring output);
-
-  void write(const ConfigureWizard &wizard,wofstream &file);
-
-  vector<Project*> _projects;
-};
-
-#endif // __Solution__
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#ifndef __Solution__
+#define __Solution__
+
+#include "Project.h"
+#include "ConfigureWizard.h"
+#include "VersionInfo.h"
+#include "WaitDialog.h"
+
+class Solution
+{
+public:
+  Solution();
+
+  int loadProjectFiles(const ConfigureWizard &wizard);
+
+  void loadProjects();
+
+  void write(const ConfigureWizard &wizard,WaitDialog &waitDialog);
+
+private:
+
+  void assignJobPools(const ConfigureWizard &wizard);
+
+  void assignObjectLibraries(const ConfigureWizard &wizard);
+
+  void checkKeyword(const wstring keyword);
+
+  void collectObjectLibraries(ProjectFile *projectFile,vector<ProjectFile*> &objectLibraries);
+
+  wstring delegatesFingerprint(const ConfigureWizard &wizard);
+
+  wstring getFileName(const ConfigureWizard &wizard);
+
+  wstring getFolder();
+
+  Project *findProject(const wstring &name);
+
+  bool isImageMagick7(const ConfigureWizard &wizard);
+
+  bool isWritten(const ConfigureWizard &wizard,const ProjectFile *projectFile);
+
+  void parseVariant(const wstring &variant,QuantumDepth &quantumDepth,bool &useHDRI);
+
+  void selectFormats(const ConfigureWizard &wizard);
+
+  wstring targetIsaOption(const ConfigureWizard &wizard);
+
+  void writeDelegates(const ConfigureWizard &wizard);
+
+  void writeDelegatesPackage(const ConfigureWizard &wizard,wofstream &file);
+
+  void writeHeader(const ConfigureWizard &wizard,wofstream &file,const wstring &projectName);
+
+  void writeInterfaceLibraries(const ConfigureWizard &wizard,wofstream &file);
+
+  void writeJobPools(const ConfigureWizard &wizard,wofstream &file);
+
+  void writeLanguages(const ConfigureWizard &wizard,wofstream &file,const bool exported,const wstring &directory);
+
+  void writeMagickBaseConfig(const ConfigureWizard &wizard);
+
+  void writeMagickBaseConfig(const ConfigureWizard &wizard,const QuantumDepth quantumDepth,const bool useHDRI,const wstring &fileName);
+
+  void writeModuleShards(const ConfigureWizard &wizard);
+
+  void writeMakeFile(const ConfigureWizard &wizard);
+
+  void writeNotice(const ConfigureWizard &wizard,const VersionInfo &versionInfo);
+
+  void writePolicyConfig(const ConfigureWizard &wizard);
+
+  void writeRuntimeLibrary(const ConfigureWizard &wizard,wofstream &file);
+
+  void writeStaticModules(const ConfigureWizard &wizard);
+
+  void writeThresholdMap(const ConfigureWizard &wizard);
+
+  void writeVersion(const ConfigureWizard &wizard,const VersionInfo &versionInfo);
+
+  void writeVersion(const ConfigureWizard &wizard,const VersionInfo &versionInfo,wstring input,wstring output);
+
+  void write(const ConfigureWizard &wizard,wofstream &file);
+
+  vector<wstring>  _coderModules;
+  size_t           _heavyLinkMemory;
+  size_t           _linkMemory;
+  vector<Project*> _projects;
+};
+
+#endif // __Solution__
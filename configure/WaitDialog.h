@@ -1,51 +1,51 @@
-/*
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-%                                                                             %
-%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
-%  dedicated to making software imaging solutions freely available.           %
-%                                                                             %
-%  You may not use this file except in compliance with the License.  You may  %
-%  obtain a copy of the License at                                            %
-%                                                                             %
-%    http://www.imagemagick.org/script/license.php                            %
-%                                                                             %
-%  Unless required by applicable law or agreed to in writing, software        %
-%  distributed under the License is distributed on an "AS IS" BASIS,          %
-%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
-%  See the License for the specific language governing permissions and        %
-%  limitations under the License.                                             %
-%                                                                             %
-%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
-*/
-#ifndef __WaitDialog__
-#define __WaitDialog__
-
-#include "resource.h"
-
-class WaitDialog : public CDialog
-{
-public:
-
-  WaitDialog();
-
-  ~WaitDialog();
-
-  int getSteps() const;
-
-  void setSteps(const int steps);
-
-  void nextStep(const wstring &description);
-
-private:
-
-  void pump();
-
-  void setMessageText(const wstring &text);
-
-  void setPercentComplete(int percent);
-
-  int _steps;
-  int _current;
-};
-
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright 2014-2021 ImageMagick Studio LLC, a non-profit organization      %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#ifndef __WaitDialog__
+#define __WaitDialog__
+
+#include "resource.h"
+
+class WaitDialog : public CDialog
+{
+public:
+
+  WaitDialog();
+
+  ~WaitDialog();
+
+  int getSteps() const;
+
+  void setSteps(const int steps);
+
+  void nextStep(const wstring &description);
+
+private:
+
+  void pump();
+
+  void setMessageText(const wstring &text);
+
+  void setPercentComplete(int percent);
+
+  int _steps;
+  int _current;
+};
+
 #endif // __WaitDialog__
\ No newline at end of file
@@ -39,6 +39,12 @@
 #define IDD_WAITDIALOG                  1025
 #define IDC_MSGCTRL                     1026
 #define IDC_PROGRESSCTRL                1027
+#define IDC_TARGET_LINUX                1028
+#define IDC_CACHEABLE_DEBUG_INFO        1029
+#define IDC_COMPILER_LAUNCHER           1030
+#define IDC_FLAT_CMAKE                  1031
+#define IDC_DELAY_LOAD                  1032
+#define IDC_TARGET_ISA                  1033
 
 // Next default values for new objects
 // 
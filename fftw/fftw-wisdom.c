@@ -0,0 +1,118 @@
+/*
+  Creates the FFTW wisdom that MagickCore imports before its first plan.  The
+  build runs this tool once on the build machine and it can be run again on
+  the production hardware to tune the plans for that processor:
+
+    fftw-wisdom [-j threads] [-t seconds] fftw.wisdom
+
+  The existing wisdom in the output file is imported first so running the
+  tool again only refines it.  ImageMagick pads the image to a square with an
+  even extent before the transform so only square plans are created.
+
+  FFTW only uses wisdom for plans with the same number of threads.
+  MagickCore plans with one thread, which is the default of -j.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fftw3.h"
+
+static const int
+  extents[] =
+  {
+    64, 128, 256, 480, 512, 600, 720, 768, 1024, 1080, 1200, 1440, 1536,
+    2048, 2160, 3000, 4000, 4096
+  };
+
+static int PlanExtent(const int extent)
+{
+  double
+    *pixels;
+
+  fftw_complex
+    *frequencies;
+
+  fftw_plan
+    forward,
+    inverse;
+
+  pixels=(double *) fftw_malloc((size_t) extent*extent*sizeof(*pixels));
+  frequencies=(fftw_complex *) fftw_malloc((size_t) extent*(extent/2+1)*
+    sizeof(*frequencies));
+  if ((pixels == (double *) NULL) || (frequencies == (fftw_complex *) NULL))
+    {
+      fftw_free(pixels);
+      fftw_free(frequencies);
+      return(0);
+    }
+  forward=fftw_plan_dft_r2c_2d(extent,extent,pixels,frequencies,FFTW_MEASURE);
+  inverse=fftw_plan_dft_c2r_2d(extent,extent,frequencies,pixels,FFTW_MEASURE);
+  if (forward != (fftw_plan) NULL)
+    fftw_destroy_plan(forward);
+  if (inverse != (fftw_plan) NULL)
+    fftw_destroy_plan(inverse);
+  fftw_free(pixels);
+  fftw_free(frequencies);
+  return((forward != (fftw_plan) NULL) && (inverse != (fftw_plan) NULL));
+}
+
+int main(int argc,char **argv)
+{
+  const char
+    *fileName;
+
+  double
+    seconds;
+
+  int
+    i,
+    threads;
+
+  fileName=(const char *) NULL;
+  seconds=2.0;
+  threads=1;
+  for (i=1; i < argc; i++)
+  {
+    if ((strcmp(argv[i],"-j") == 0) && (i+1 < argc))
+      threads=atoi(argv[++i]);
+    else if ((strcmp(argv[i],"-t") == 0) && (i+1 < argc))
+      seconds=atof(argv[++i]);
+    else if (argv[i][0] != '-')
+      fileName=argv[i];
+    else
+      fileName=(const char *) NULL;
+  }
+  if ((fileName == (const char *) NULL) || (threads < 1))
+    {
+      fprintf(stderr,"Usage: fftw-wisdom [-j threads] [-t seconds] file\n");
+      return(1);
+    }
+  if (threads > 1)
+    {
+      if (fftw_init_threads() == 0)
+        threads=1;
+      else
+        fftw_plan_with_nthreads(threads);
+    }
+  (void) fftw_import_wisdom_from_filename(fileName);
+  /*
+    The time limit applies to each plan.
+  */
+  fftw_set_timelimit(seconds);
+  for (i=0; i < (int) (sizeof(extents)/sizeof(*extents)); i++)
+  {
+    printf("Planning %dx%d with %d thread(s)\n",extents[i],extents[i],
+      threads);
+    fflush(stdout);
+    if (PlanExtent(extents[i]) == 0)
+      fprintf(stderr,"Unable to plan %dx%d\n",extents[i],extents[i]);
+  }
+  if (fftw_export_wisdom_to_filename(fileName) == 0)
+    {
+      fprintf(stderr,"Unable to write %s\n",fileName);
+      return(1);
+    }
+  if (threads > 1)
+    fftw_cleanup_threads();
+  return(0);
+}
@@ -0,0 +1,47 @@
+/*
+  Checks that the SIMD extensions of libjpeg-turbo are linked and selected at
+  runtime. The build uses jsimd_none.c when the kernels are not assembled and
+  all the jsimd_can functions would return zero.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+
+extern int jsimd_can_rgb_ycc(void);
+extern int jsimd_can_ycc_rgb(void);
+extern int jsimd_can_h2v2_downsample(void);
+extern int jsimd_can_convsamp(void);
+extern int jsimd_can_fdct_islow(void);
+extern int jsimd_can_quantize(void);
+extern int jsimd_can_idct_islow(void);
+extern int jsimd_can_huff_encode_one_block(void);
+
+#define CHECK(function) \
+  if (!function()) \
+  { \
+    printf("%s returned false\n",#function); \
+    status=1; \
+  }
+
+int main(void)
+{
+  int
+    status;
+
+  /* The SIMD extensions can be disabled with the environment */
+  if (getenv("JSIMD_FORCENONE") != NULL)
+  {
+    printf("JSIMD_FORCENONE is set, skipping the check\n");
+    return(0);
+  }
+
+  status=0;
+  CHECK(jsimd_can_rgb_ycc);
+  CHECK(jsimd_can_ycc_rgb);
+  CHECK(jsimd_can_h2v2_downsample);
+  CHECK(jsimd_can_convsamp);
+  CHECK(jsimd_can_fdct_islow);
+  CHECK(jsimd_can_quantize);
+  CHECK(jsimd_can_idct_islow);
+  CHECK(jsimd_can_huff_encode_one_block);
+  return(status);
+}